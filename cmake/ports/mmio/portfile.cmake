@@ -1,22 +1,22 @@
-vcpkg_from_github(
-	OUT_SOURCE_PATH SOURCE_PATH
-	REPO Ryan-rsm-McKenzie/mmio
-	REF 1.0.0
-	SHA512 e5b7409eb32b0c07df3a6656af7967df5767550dfbe167dddb3e04d29951a2773e0e276926c470304523c64fa53ace87b8d408f71d4abf771978ea1fe0a10185
-	HEAD_REF master
-)
-
-vcpkg_cmake_configure(
-	SOURCE_PATH "${SOURCE_PATH}"
-	OPTIONS
-		-DBUILD_TESTING=OFF
-)
-vcpkg_cmake_install()
-vcpkg_cmake_config_fixup(CONFIG_PATH "lib/cmake/mmio")
-
-file(REMOVE_RECURSE
-	"${CURRENT_PACKAGES_DIR}/debug/include"
-	"${CURRENT_PACKAGES_DIR}/debug/share"
-)
-
-file(INSTALL "${SOURCE_PATH}/LICENSE" DESTINATION "${CURRENT_PACKAGES_DIR}/share/${PORT}" RENAME copyright)
+vcpkg_from_github(
+	OUT_SOURCE_PATH SOURCE_PATH
+	REPO Ryan-rsm-McKenzie/mmio
+	REF 1.0.0
+	SHA512 e5b7409eb32b0c07df3a6656af7967df5767550dfbe167dddb3e04d29951a2773e0e276926c470304523c64fa53ace87b8d408f71d4abf771978ea1fe0a10185
+	HEAD_REF master
+)
+
+vcpkg_cmake_configure(
+	SOURCE_PATH "${SOURCE_PATH}"
+	OPTIONS
+		-DBUILD_TESTING=OFF
+)
+vcpkg_cmake_install()
+vcpkg_cmake_config_fixup(CONFIG_PATH "lib/cmake/mmio")
+
+file(REMOVE_RECURSE
+	"${CURRENT_PACKAGES_DIR}/debug/include"
+	"${CURRENT_PACKAGES_DIR}/debug/share"
+)
+
+file(INSTALL "${SOURCE_PATH}/LICENSE" DESTINATION "${CURRENT_PACKAGES_DIR}/share/${PORT}" RENAME copyright)
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Utils
+{
+	struct EditKeyHash
+	{
+		template <typename T>
+		std::size_t operator()(const T& a_key) const noexcept
+		{
+			return std::hash<T>{}(a_key);
+		}
+
+		template <typename T1, typename T2>
+		std::size_t operator()(const std::pair<T1, T2>& a_key) const noexcept
+		{
+			std::size_t hash = (*this)(a_key.first);
+			hash ^= (*this)(a_key.second) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+			return hash;
+		}
+	};
+
+	// Adapts the keyword array of any BGSKeywordForm to ArrayEditor. Assign installs the edited keywords
+	// in one step, reusing the existing array when it does not grow and allocating once otherwise.
+	class KeywordArray
+	{
+	public:
+		using value_type = RE::BGSKeyword*;
+
+		explicit KeywordArray(RE::BGSKeywordForm* a_keywordForm) : keywordForm_(a_keywordForm) {}
+
+		RE::BGSKeyword** begin() const { return keywordForm_->keywords; }
+		RE::BGSKeyword** end() const { return keywordForm_->keywords ? keywordForm_->keywords + keywordForm_->numKeywords : nullptr; }
+		std::uint32_t size() const { return keywordForm_->keywords ? keywordForm_->numKeywords : 0; }
+
+		void Assign(std::span<const value_type> a_keywords)
+		{
+			const auto keywordCount = static_cast<std::uint32_t>(a_keywords.size());
+
+			if (keywordCount == 0)
+			{
+				if (keywordForm_->keywords)
+				{
+					RE::free(keywordForm_->keywords);
+				}
+
+				keywordForm_->keywords = nullptr;
+				keywordForm_->numKeywords = 0;
+				return;
+			}
+
+			if (keywordForm_->keywords && keywordCount <= keywordForm_->numKeywords)
+			{
+				std::copy(a_keywords.begin(), a_keywords.end(), keywordForm_->keywords);
+				keywordForm_->numKeywords = keywordCount;
+				return;
+			}
+
+			auto* newKeywords = static_cast<RE::BGSKeyword**>(RE::malloc(sizeof(RE::BGSKeyword*) * keywordCount));
+			if (!newKeywords)
+			{
+				logger::critical("Failed to allocate the Keywords array.");
+				return;
+			}
+
+			std::copy(a_keywords.begin(), a_keywords.end(), newKeywords);
+
+			if (keywordForm_->keywords)
+			{
+				RE::free(keywordForm_->keywords);
+			}
+
+			keywordForm_->keywords = newKeywords;
+			keywordForm_->numKeywords = keywordCount;
+		}
+
+	private:
+		RE::BGSKeywordForm* keywordForm_;
+	};
+
+	// Applies Clear/Delete/Add/AddIfNotExists/Set edits to a BSTArray-like container on a working copy.
+	// Membership is answered by hash lookups keyed on a_keyOf, so a script of m edits over n elements
+	// costs O(n + m). Edits are applied in call order with the same semantics as sequential in-place
+	// edits: Delete removes the first remaining match per key, Set updates the first match or appends.
+	// Commit writes the result back with a single reserve.
+	template <typename ArrayT, typename KeyFn>
+	class ArrayEditor
+	{
+	public:
+		using value_type = typename ArrayT::value_type;
+		using key_type = std::remove_cvref_t<std::invoke_result_t<KeyFn&, const value_type&>>;
+
+		ArrayEditor(ArrayT& a_array, KeyFn a_keyOf) : array_(a_array), keyOf_(std::move(a_keyOf))
+		{
+			elements_.reserve(a_array.size());
+			for (const auto& element : a_array)
+			{
+				elements_.emplace_back(element);
+			}
+		}
+
+		void Clear()
+		{
+			modified_ = modified_ || !elements_.empty();
+			elements_.clear();
+			indexMap_.clear();
+			indexed_ = false;
+		}
+
+		// Removes, for every key in a_keys, the first remaining element whose a_proj(element) equals it.
+		template <typename KeyRangeT, typename ProjFn>
+		void Delete(const KeyRangeT& a_keys, ProjFn a_proj)
+		{
+			using proj_key_type = std::remove_cvref_t<std::invoke_result_t<ProjFn&, const value_type&>>;
+
+			std::unordered_map<proj_key_type, std::size_t, EditKeyHash> pendingMap;
+			for (const auto& key : a_keys)
+			{
+				++pendingMap[key];
+			}
+
+			if (pendingMap.empty() || elements_.empty())
+			{
+				return;
+			}
+
+			std::size_t writeIndex = 0;
+			for (std::size_t readIndex = 0; readIndex < elements_.size(); ++readIndex)
+			{
+				if (!pendingMap.empty())
+				{
+					const auto it = pendingMap.find(a_proj(elements_[readIndex]));
+					if (it != pendingMap.end())
+					{
+						if (--it->second == 0)
+						{
+							pendingMap.erase(it);
+						}
+
+						continue;
+					}
+				}
+
+				if (writeIndex != readIndex)
+				{
+					elements_[writeIndex] = elements_[readIndex];
+				}
+				++writeIndex;
+			}
+
+			if (writeIndex != elements_.size())
+			{
+				elements_.resize(writeIndex);
+				indexMap_.clear();
+				indexed_ = false;
+				modified_ = true;
+			}
+		}
+
+		template <typename KeyRangeT>
+		void Delete(const KeyRangeT& a_keys)
+		{
+			Delete(a_keys, keyOf_);
+		}
+
+		void Add(const value_type& a_element)
+		{
+			if (indexed_)
+			{
+				indexMap_.emplace(keyOf_(a_element), elements_.size());
+			}
+
+			elements_.emplace_back(a_element);
+			modified_ = true;
+		}
+
+		void AddIfNotExists(const value_type& a_element)
+		{
+			BuildIndex();
+
+			if (indexMap_.emplace(keyOf_(a_element), elements_.size()).second)
+			{
+				elements_.emplace_back(a_element);
+				modified_ = true;
+			}
+		}
+
+		void Set(const value_type& a_element)
+		{
+			BuildIndex();
+
+			const auto [it, inserted] = indexMap_.emplace(keyOf_(a_element), elements_.size());
+			if (inserted)
+			{
+				elements_.emplace_back(a_element);
+			}
+			else
+			{
+				elements_[it->second] = a_element;
+			}
+
+			modified_ = true;
+		}
+
+		void Commit()
+		{
+			if (!modified_)
+			{
+				return;
+			}
+
+			if constexpr (requires { array_.Assign(std::span<const value_type>(elements_)); })
+			{
+				array_.Assign(std::span<const value_type>(elements_));
+			}
+			else
+			{
+				array_.clear();
+				array_.reserve(static_cast<std::uint32_t>(elements_.size()));
+				for (const auto& element : elements_)
+				{
+					array_.push_back(element);
+				}
+			}
+
+			modified_ = false;
+		}
+
+	private:
+		// Maps each key to its first element, matching the first-match lookups of in-place edits.
+		void BuildIndex()
+		{
+			if (indexed_)
+			{
+				return;
+			}
+
+			indexMap_.reserve(elements_.size());
+			for (std::size_t elementIndex = 0; elementIndex < elements_.size(); ++elementIndex)
+			{
+				indexMap_.emplace(keyOf_(elements_[elementIndex]), elementIndex);
+			}
+
+			indexed_ = true;
+		}
+
+		ArrayT& array_;
+		KeyFn keyOf_;
+		std::vector<value_type> elements_;
+		std::unordered_map<key_type, std::size_t, EditKeyHash> indexMap_;
+		bool indexed_ = false;
+		bool modified_ = false;
+	};
+}  // namespace Utils
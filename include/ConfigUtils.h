@@ -1,6 +1,12 @@
 #pragma once
 
+#include "FormFilters.h"
 #include "Parsers.h"
+#include "PatchScheduler.h"
+#include "Utils.h"
+
+#include <map>
+#include <mutex>
 
 namespace ConfigUtils
 {
@@ -55,4 +61,370 @@ namespace ConfigUtils
 			}
 		}
 	}
+
+	template <typename ConfigT>
+	inline void CollectExpressions(const std::vector<Parsers::Statement<ConfigT>>& a_configVec, std::vector<const ConfigT*>& a_expressions)
+	{
+		for (const auto& configData : a_configVec)
+		{
+			if (configData.Type == Parsers::StatementType::kExpression)
+			{
+				a_expressions.emplace_back(std::addressof(configData.ExpressionStatement.value()));
+			}
+			else if (configData.Type == Parsers::StatementType::kConditional)
+			{
+				CollectExpressions(configData.ConditionalStatement->Evaluates(), a_expressions);
+			}
+		}
+	}
+
+	// Same result as Prepare(a_configVec, ...) where each statement runs a_prepareFunc(target, statement, a_patchMap[target])
+	// for every target returned by a_resolveFunc(statement), but in two parallel passes. The targets of all statements
+	// are resolved first. Every target is then inserted into a_patchMap in first-use order, and its statements are
+	// applied in statement order by the one worker that owns it. Messages are logged in the sequential order.
+	//
+	// a_prepareFunc may also take only (statement, patchData). The targets that receive the same statements in the same
+	// order then get the same patch data, so each such statement list is prepared once and copied to its targets, and
+	// the form lookups of a statement run once per list instead of once per target. A message that a statement logs
+	// the same way for several targets is logged once.
+	template <typename ConfigT, typename PatchMapT, typename ResolveF, typename PrepareF>
+	inline void Prepare(const std::vector<Parsers::Statement<ConfigT>>& a_configVec, PatchMapT& a_patchMap, ResolveF a_resolveFunc, PrepareF a_prepareFunc)
+	{
+		using TargetT = typename PatchMapT::key_type;
+		using PatchDataT = typename PatchMapT::mapped_type;
+
+		constexpr bool kSharedPrepare = std::is_invocable_v<PrepareF&, const ConfigT&, PatchDataT&>;
+
+		struct ResolvedStatement
+		{
+			std::vector<TargetT> Targets;
+			PatchScheduler::LogBuffer Log;
+		};
+
+		struct TargetEntry
+		{
+			std::uint32_t StatementIndex;
+			std::uint32_t TargetPosition;
+		};
+
+		struct PendingTarget
+		{
+			TargetT Target;
+			PatchDataT* PatchData;
+			std::vector<TargetEntry> Entries;
+			bool Inserted;
+			std::size_t GroupIndex;
+		};
+
+		// The targets that share a prepared patch data. A target that already had patch data gets a group of its own
+		// and is prepared in place.
+		struct PatchGroup
+		{
+			std::size_t FirstTargetIndex;
+			bool Shared;
+			PatchDataT PatchData;
+		};
+
+		struct PrepareLog
+		{
+			TargetEntry Entry;
+			PatchScheduler::LogBuffer Log;
+		};
+
+		constexpr std::size_t kResolveGrainSize = 16;
+		constexpr std::size_t kPrepareGrainSize = 64;
+
+		std::vector<const ConfigT*> expressions;
+		CollectExpressions(a_configVec, expressions);
+
+		std::vector<ResolvedStatement> resolvedStatements(expressions.size());
+
+		PatchScheduler::ParallelFor(expressions.size(), kResolveGrainSize, [&](std::size_t a_statementIndex) {
+			auto& resolvedStatement = resolvedStatements[a_statementIndex];
+
+			PatchScheduler::ScopedLogCapture logCapture(resolvedStatement.Log);
+			resolvedStatement.Targets = a_resolveFunc(*expressions[a_statementIndex]);
+		});
+
+		std::vector<PendingTarget> pendingTargets;
+		std::unordered_map<TargetT, std::size_t> pendingTargetIndexMap;
+
+		for (std::uint32_t statementIndex = 0; statementIndex < resolvedStatements.size(); ++statementIndex)
+		{
+			const auto& targets = resolvedStatements[statementIndex].Targets;
+			for (std::uint32_t targetPosition = 0; targetPosition < targets.size(); ++targetPosition)
+			{
+				const auto [it, inserted] = pendingTargetIndexMap.emplace(targets[targetPosition], pendingTargets.size());
+				if (inserted)
+				{
+					pendingTargets.emplace_back(PendingTarget{ targets[targetPosition], nullptr, {}, false, 0 });
+				}
+
+				pendingTargets[it->second].Entries.emplace_back(TargetEntry{ statementIndex, targetPosition });
+			}
+		}
+
+		// Inserting up front keeps the map's insertion order and leaves it unchanged while the workers write into it.
+		// Addresses are taken only once every target is in, since inserting into a flat table can move its entries.
+		a_patchMap.reserve(a_patchMap.size() + pendingTargets.size());
+		for (auto& pendingTarget : pendingTargets)
+		{
+			const auto previousSize = a_patchMap.size();
+			a_patchMap[pendingTarget.Target];
+			pendingTarget.Inserted = a_patchMap.size() != previousSize;
+		}
+
+		for (auto& pendingTarget : pendingTargets)
+		{
+			pendingTarget.PatchData = std::addressof(a_patchMap[pendingTarget.Target]);
+		}
+
+		std::vector<PatchGroup> patchGroups;
+		std::map<std::vector<std::uint32_t>, std::size_t> patchGroupIndexMap;
+
+		for (std::size_t targetIndex = 0; targetIndex < pendingTargets.size(); ++targetIndex)
+		{
+			auto& pendingTarget = pendingTargets[targetIndex];
+
+			if constexpr (kSharedPrepare)
+			{
+				if (pendingTarget.Inserted)
+				{
+					std::vector<std::uint32_t> statementIndices;
+					statementIndices.reserve(pendingTarget.Entries.size());
+					for (const auto& entry : pendingTarget.Entries)
+					{
+						statementIndices.emplace_back(entry.StatementIndex);
+					}
+
+					const auto [it, inserted] = patchGroupIndexMap.emplace(std::move(statementIndices), patchGroups.size());
+					if (inserted)
+					{
+						patchGroups.emplace_back(PatchGroup{ targetIndex, true, {} });
+					}
+
+					pendingTarget.GroupIndex = it->second;
+					continue;
+				}
+			}
+
+			pendingTarget.GroupIndex = patchGroups.size();
+			patchGroups.emplace_back(PatchGroup{ targetIndex, false, {} });
+		}
+
+		std::mutex prepareLogMutex;
+		std::vector<PrepareLog> prepareLogs;
+
+		PatchScheduler::ParallelFor(patchGroups.size(), kPrepareGrainSize, [&](std::size_t a_groupIndex) {
+			auto& patchGroup = patchGroups[a_groupIndex];
+			const auto& pendingTarget = pendingTargets[patchGroup.FirstTargetIndex];
+			auto& patchData = patchGroup.Shared ? patchGroup.PatchData : *pendingTarget.PatchData;
+
+			PatchScheduler::LogBuffer log;
+			for (const auto& entry : pendingTarget.Entries)
+			{
+				{
+					PatchScheduler::ScopedLogCapture logCapture(log);
+					if constexpr (kSharedPrepare)
+					{
+						a_prepareFunc(*expressions[entry.StatementIndex], patchData);
+					}
+					else
+					{
+						a_prepareFunc(pendingTarget.Target, *expressions[entry.StatementIndex], patchData);
+					}
+				}
+
+				if (!log.empty())
+				{
+					std::scoped_lock lock(prepareLogMutex);
+					prepareLogs.emplace_back(PrepareLog{ entry, std::move(log) });
+					log.clear();
+				}
+			}
+		});
+
+		if constexpr (kSharedPrepare)
+		{
+			PatchScheduler::ParallelFor(pendingTargets.size(), kPrepareGrainSize, [&](std::size_t a_targetIndex) {
+				const auto& pendingTarget = pendingTargets[a_targetIndex];
+				const auto& patchGroup = patchGroups[pendingTarget.GroupIndex];
+				if (patchGroup.Shared)
+				{
+					*pendingTarget.PatchData = patchGroup.PatchData;
+				}
+			});
+		}
+
+		std::sort(prepareLogs.begin(), prepareLogs.end(), [](const PrepareLog& a_lhs, const PrepareLog& a_rhs) {
+			return a_lhs.Entry.StatementIndex != a_rhs.Entry.StatementIndex ? a_lhs.Entry.StatementIndex < a_rhs.Entry.StatementIndex : a_lhs.Entry.TargetPosition < a_rhs.Entry.TargetPosition;
+		});
+
+		const auto isSameLog = [](const PatchScheduler::LogBuffer& a_lhs, const PatchScheduler::LogBuffer& a_rhs) {
+			return std::equal(a_lhs.begin(), a_lhs.end(), a_rhs.begin(), a_rhs.end(), [](const auto& a_lhsMsg, const auto& a_rhsMsg) {
+				return a_lhsMsg.level == a_rhsMsg.level && a_lhsMsg.payload == a_rhsMsg.payload;
+			});
+		};
+
+		auto prepareLogIt = prepareLogs.begin();
+		for (std::uint32_t statementIndex = 0; statementIndex < resolvedStatements.size(); ++statementIndex)
+		{
+			PatchScheduler::ReplayLog(resolvedStatements[statementIndex].Log);
+
+			// Replaying moves the messages out, so the distinct logs are picked before any is replayed.
+			std::vector<PatchScheduler::LogBuffer*> distinctLogs;
+			for (; prepareLogIt != prepareLogs.end() && prepareLogIt->Entry.StatementIndex == statementIndex; ++prepareLogIt)
+			{
+				const auto& log = prepareLogIt->Log;
+				if (std::none_of(distinctLogs.begin(), distinctLogs.end(), [&](const auto* a_log) { return isSameLog(*a_log, log); }))
+				{
+					distinctLogs.emplace_back(std::addressof(prepareLogIt->Log));
+				}
+			}
+
+			for (auto* log : distinctLogs)
+			{
+				PatchScheduler::ReplayLog(*log);
+			}
+		}
+	}
+
+	template <typename FormT, typename ConfigT>
+	inline std::vector<FormT*> GetFilteredForms(const ConfigT& a_configData, std::string_view a_formDesc, std::initializer_list<RE::ENUM_FORM_ID> a_formTypes = { FormT::FORM_ID })
+	{
+		using FilterT = decltype(a_configData.Filter);
+
+		std::vector<FormT*> forms;
+
+		if (a_configData.Filter == FilterT::kFormID)
+		{
+			auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
+			if (!filterForm)
+			{
+				logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
+				return forms;
+			}
+
+			auto* form = filterForm->As<FormT>();
+			if (!form)
+			{
+				logger::warn("'{}' is not {}.", a_configData.FilterForm, a_formDesc);
+				return forms;
+			}
+
+			forms.emplace_back(form);
+		}
+		else if (a_configData.Filter == FilterT::kEditorID)
+		{
+			for (const auto formType : a_formTypes)
+			{
+				auto* filterForm = FormFilters::GetFormByEditorID(formType, a_configData.FilterForm);
+				if (!filterForm)
+				{
+					continue;
+				}
+
+				auto* form = filterForm->As<FormT>();
+				if (form)
+				{
+					forms.emplace_back(form);
+				}
+			}
+
+			if (forms.empty())
+			{
+				logger::warn("Invalid FilterEditorID: '{}'.", a_configData.FilterForm);
+			}
+		}
+		else if (a_configData.Filter == FilterT::kEditorIDPattern)
+		{
+			for (const auto formType : a_formTypes)
+			{
+				for (auto* filterForm : FormFilters::GetFormsByEditorIDPattern(formType, a_configData.FilterForm))
+				{
+					auto* form = filterForm->As<FormT>();
+					if (form)
+					{
+						forms.emplace_back(form);
+					}
+				}
+			}
+
+			if (forms.empty())
+			{
+				logger::warn("EditorID pattern '{}' did not match any form.", a_configData.FilterForm);
+			}
+		}
+
+		if constexpr (requires { FilterT::kKeyword; })
+		{
+			if (a_configData.Filter == FilterT::kKeyword)
+			{
+				for (const auto formType : a_formTypes)
+				{
+					for (auto* filterForm : FormFilters::GetFormsByKeywords(formType, a_configData.FilterForm))
+					{
+						auto* form = filterForm->As<FormT>();
+						if (form)
+						{
+							forms.emplace_back(form);
+						}
+					}
+				}
+
+				if (forms.empty())
+				{
+					logger::warn("Keyword filter '{}' did not match any form.", a_configData.FilterForm);
+				}
+			}
+		}
+
+		if constexpr (requires { FilterT::kPlugin; })
+		{
+			if (a_configData.Filter == FilterT::kPlugin)
+			{
+				for (const auto formType : a_formTypes)
+				{
+					for (auto* filterForm : FormFilters::GetFormsByPlugin(formType, a_configData.FilterForm))
+					{
+						auto* form = filterForm->As<FormT>();
+						if (form)
+						{
+							forms.emplace_back(form);
+						}
+					}
+				}
+
+				if (forms.empty())
+				{
+					logger::warn("Plugin filter '{}' did not match any form.", a_configData.FilterForm);
+				}
+			}
+		}
+
+		if constexpr (requires { FilterT::kPredicates; })
+		{
+			if (a_configData.Filter == FilterT::kPredicates)
+			{
+				for (const auto formType : a_formTypes)
+				{
+					for (auto* filterForm : FormFilters::GetFormsByPredicates(formType, a_configData.FilterForm))
+					{
+						auto* form = filterForm->As<FormT>();
+						if (form)
+						{
+							forms.emplace_back(form);
+						}
+					}
+				}
+
+				if (forms.empty())
+				{
+					logger::warn("Predicate filter '{}' did not match any form.", a_configData.FilterForm);
+				}
+			}
+		}
+
+		return forms;
+	}
 }  // namespace ConfigUtils
@@ -0,0 +1,54 @@
+#pragma once
+
+namespace FormFilters
+{
+	using FieldGetter = float (*)(RE::TESForm*);
+
+	struct Predicate
+	{
+		enum class PredicateType
+		{
+			kKeyword,
+			kPlugin,
+			kRange
+		};
+
+		PredicateType Type;
+		std::string Value;
+		FieldGetter Getter = nullptr;
+		float Min = 0.0f;
+		float Max = 0.0f;
+	};
+
+	struct KeywordToken
+	{
+		enum class TokenType
+		{
+			kKeyword,
+			kAnd,
+			kOr,
+			kNot
+		};
+
+		TokenType Type;
+		std::string Form;
+	};
+
+	// Describes what a subsystem's FilterByPredicates statements can scan: the form types and the numeric fields usable in Range().
+	struct PredicateContext
+	{
+		std::vector<RE::ENUM_FORM_ID> FormTypes;
+		std::unordered_map<std::string_view, FieldGetter> Fields;
+	};
+
+	bool AddEditorIDPattern(std::string_view a_pattern);
+	RE::TESForm* GetFormByEditorID(RE::ENUM_FORM_ID a_formType, std::string_view a_editorID);
+	const std::vector<RE::TESForm*>& GetFormsByEditorIDPattern(RE::ENUM_FORM_ID a_formType, std::string_view a_pattern);
+	void AddPredicateFilter(const PredicateContext& a_context, std::string_view a_key, const std::vector<Predicate>& a_predicates);
+	const std::vector<RE::TESForm*>& GetFormsByPredicates(RE::ENUM_FORM_ID a_formType, std::string_view a_key);
+	void AddKeywordFilter(std::string_view a_key, const std::vector<KeywordToken>& a_postfixTokens);
+	const std::vector<RE::TESForm*>& GetFormsByKeywords(RE::ENUM_FORM_ID a_formType, std::string_view a_key);
+	void AddPluginFilter(std::string_view a_key, std::string_view a_pluginName, bool a_overridden);
+	const std::vector<RE::TESForm*>& GetFormsByPlugin(RE::ENUM_FORM_ID a_formType, std::string_view a_key);
+	void Clear();
+}  // namespace FormFilters
@@ -4,4 +4,5 @@ namespace NPCs
 {
 	void ReadConfigs();
 	void Install();
+	void PreparePatch();
 }  // namespace NPCs
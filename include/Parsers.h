@@ -3,6 +3,7 @@
 #include <type_traits>
 
 #include "Configs.h"
+#include "FormFilters.h"
 #include "Utils.h"
 
 namespace Parsers
@@ -549,9 +550,345 @@ namespace Parsers
 			}
 			form += token;
 
+			Utils::AddPendingForm(pluginNameOpt.value(), token);
+
 			return form;
 		}
 
+		template <typename FilterT>
+		std::optional<std::string> ParseFilterForm(FilterT a_filter)
+		{
+			if (a_filter == FilterT::kEditorID)
+			{
+				return ParseString();
+			}
+			else if (a_filter == FilterT::kEditorIDPattern)
+			{
+				return ParseEditorIDPattern();
+			}
+
+			if constexpr (requires { FilterT::kKeyword; })
+			{
+				if (a_filter == FilterT::kKeyword)
+				{
+					return ParseKeywordExpression();
+				}
+			}
+
+			if constexpr (requires { FilterT::kPlugin; })
+			{
+				if (a_filter == FilterT::kPlugin)
+				{
+					return ParsePluginFilter();
+				}
+			}
+
+			return ParseForm();
+		}
+
+		std::optional<std::string> ParsePredicates(const FormFilters::PredicateContext& a_context)
+		{
+			std::vector<FormFilters::Predicate> predicates;
+			std::string key;
+
+			while (true)
+			{
+				FormFilters::Predicate predicate{};
+
+				auto token = reader.GetToken();
+				std::string predicateName{ token };
+
+				if (token == "Keyword")
+				{
+					predicate.Type = FormFilters::Predicate::PredicateType::kKeyword;
+				}
+				else if (token == "Plugin")
+				{
+					predicate.Type = FormFilters::Predicate::PredicateType::kPlugin;
+				}
+				else if (token == "Range")
+				{
+					predicate.Type = FormFilters::Predicate::PredicateType::kRange;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid Predicate '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return std::nullopt;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				if (predicate.Type == FormFilters::Predicate::PredicateType::kKeyword)
+				{
+					const auto formOpt = ParseForm();
+					if (!formOpt.has_value())
+					{
+						return std::nullopt;
+					}
+					predicate.Value = formOpt.value();
+				}
+				else if (predicate.Type == FormFilters::Predicate::PredicateType::kPlugin)
+				{
+					const auto pluginNameOpt = ParseString();
+					if (!pluginNameOpt.has_value())
+					{
+						return std::nullopt;
+					}
+					predicate.Value = pluginNameOpt.value();
+				}
+				else
+				{
+					token = reader.GetToken();
+
+					const auto fieldIt = a_context.Fields.find(token);
+					if (fieldIt == a_context.Fields.end())
+					{
+						logger::warn("Line {}, Col {}: Invalid Range field '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+						return std::nullopt;
+					}
+					predicate.Value = token;
+					predicate.Getter = fieldIt->second;
+
+					token = reader.GetToken();
+					if (token != ",")
+					{
+						logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+						return std::nullopt;
+					}
+
+					const auto minOpt = ParseNumber<float>();
+					if (!minOpt.has_value())
+					{
+						return std::nullopt;
+					}
+
+					token = reader.GetToken();
+					if (token != ",")
+					{
+						logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+						return std::nullopt;
+					}
+
+					const auto maxOpt = ParseNumber<float>();
+					if (!maxOpt.has_value())
+					{
+						return std::nullopt;
+					}
+
+					predicate.Min = minOpt.value();
+					predicate.Max = maxOpt.value();
+				}
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				if (!key.empty())
+				{
+					key += ", ";
+				}
+
+				if (predicate.Type == FormFilters::Predicate::PredicateType::kRange)
+				{
+					key += fmt::format("{}({}, {}, {})", predicateName, predicate.Value, predicate.Min, predicate.Max);
+				}
+				else
+				{
+					key += fmt::format("{}({})", predicateName, predicate.Value);
+				}
+
+				predicates.emplace_back(predicate);
+
+				if (reader.Peek() != ",")
+				{
+					break;
+				}
+				reader.GetToken();
+			}
+
+			FormFilters::AddPredicateFilter(a_context, key, predicates);
+
+			return key;
+		}
+
+		std::optional<std::string> ParseKeywordExpression()
+		{
+			std::vector<FormFilters::KeywordToken> postfixTokens;
+			std::string key;
+
+			if (!ParseKeywordOr(postfixTokens, key))
+			{
+				return std::nullopt;
+			}
+
+			FormFilters::AddKeywordFilter(key, postfixTokens);
+
+			return key;
+		}
+
+		bool ParseKeywordOr(std::vector<FormFilters::KeywordToken>& a_postfixTokens, std::string& a_key)
+		{
+			if (!ParseKeywordAnd(a_postfixTokens, a_key))
+			{
+				return false;
+			}
+
+			while (reader.Peek() == "|")
+			{
+				reader.GetToken();
+				if (reader.GetToken() != "|")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '||'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				a_key += " || ";
+
+				if (!ParseKeywordAnd(a_postfixTokens, a_key))
+				{
+					return false;
+				}
+
+				a_postfixTokens.emplace_back(FormFilters::KeywordToken{ FormFilters::KeywordToken::TokenType::kOr, {} });
+			}
+
+			return true;
+		}
+
+		bool ParseKeywordAnd(std::vector<FormFilters::KeywordToken>& a_postfixTokens, std::string& a_key)
+		{
+			if (!ParseKeywordFactor(a_postfixTokens, a_key))
+			{
+				return false;
+			}
+
+			while (reader.Peek() == "&")
+			{
+				reader.GetToken();
+				if (reader.GetToken() != "&")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '&&'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				a_key += " && ";
+
+				if (!ParseKeywordFactor(a_postfixTokens, a_key))
+				{
+					return false;
+				}
+
+				a_postfixTokens.emplace_back(FormFilters::KeywordToken{ FormFilters::KeywordToken::TokenType::kAnd, {} });
+			}
+
+			return true;
+		}
+
+		bool ParseKeywordFactor(std::vector<FormFilters::KeywordToken>& a_postfixTokens, std::string& a_key)
+		{
+			const auto token = reader.Peek();
+			if (token == "!")
+			{
+				reader.GetToken();
+				a_key += "!";
+
+				if (!ParseKeywordFactor(a_postfixTokens, a_key))
+				{
+					return false;
+				}
+
+				a_postfixTokens.emplace_back(FormFilters::KeywordToken{ FormFilters::KeywordToken::TokenType::kNot, {} });
+				return true;
+			}
+
+			if (token == "(")
+			{
+				reader.GetToken();
+				a_key += "(";
+
+				if (!ParseKeywordOr(a_postfixTokens, a_key))
+				{
+					return false;
+				}
+
+				if (reader.GetToken() != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				a_key += ")";
+				return true;
+			}
+
+			const auto formOpt = ParseForm();
+			if (!formOpt.has_value())
+			{
+				return false;
+			}
+
+			a_key += formOpt.value();
+			a_postfixTokens.emplace_back(FormFilters::KeywordToken{ FormFilters::KeywordToken::TokenType::kKeyword, formOpt.value() });
+
+			return true;
+		}
+
+		std::optional<std::string> ParsePluginFilter()
+		{
+			const auto pluginNameOpt = ParseString();
+			if (!pluginNameOpt.has_value())
+			{
+				return std::nullopt;
+			}
+
+			std::string key = pluginNameOpt.value();
+			bool overridden = false;
+
+			if (reader.Peek() == ",")
+			{
+				reader.GetToken();
+
+				const auto token = reader.GetToken();
+				if (token != "Overridden")
+				{
+					logger::warn("Line {}, Col {}: Invalid plugin filter mode '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return std::nullopt;
+				}
+
+				key += ", Overridden";
+				overridden = true;
+			}
+
+			FormFilters::AddPluginFilter(key, pluginNameOpt.value(), overridden);
+
+			return key;
+		}
+
+		std::optional<std::string> ParseEditorIDPattern()
+		{
+			const auto patternOpt = ParseString();
+			if (!patternOpt.has_value())
+			{
+				return std::nullopt;
+			}
+
+			if (!FormFilters::AddEditorIDPattern(patternOpt.value()))
+			{
+				logger::warn("Line {}, Col {}: Invalid EditorID pattern '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), patternOpt.value());
+				return std::nullopt;
+			}
+
+			return patternOpt;
+		}
+
 		std::optional<std::string> ParseString()
 		{
 			const auto token = reader.GetToken();
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+#include <spdlog/details/log_msg_buffer.h>
+#include <vector>
+
+namespace PatchScheduler
+{
+	// One subsystem's Patch() together with the form types whose data it reads and writes. Form types
+	// that are only resolved to pointers do not count as reads.
+	struct Task
+	{
+		std::string_view Name;
+		void (*Patch)();
+		std::vector<RE::ENUM_FORM_ID> Reads;
+		std::vector<RE::ENUM_FORM_ID> Writes;
+	};
+
+	using LogBuffer = std::vector<spdlog::details::log_msg_buffer>;
+
+	// Collects the messages logged on the calling thread into a_logBuffer while alive. Requires the wrapped sink.
+	class ScopedLogCapture
+	{
+	public:
+		explicit ScopedLogCapture(LogBuffer& a_logBuffer);
+		~ScopedLogCapture();
+
+		ScopedLogCapture(const ScopedLogCapture&) = delete;
+		ScopedLogCapture& operator=(const ScopedLogCapture&) = delete;
+
+	private:
+		LogBuffer* previousLogBuffer_;
+	};
+
+	// Wraps the log sink so that messages logged by a running task can be held back and written in task order.
+	std::shared_ptr<spdlog::sinks::sink> WrapSink(std::shared_ptr<spdlog::sinks::sink> a_sink);
+
+	// Logs captured messages as if they were logged now on the calling thread, then empties a_logBuffer.
+	void ReplayLog(LogBuffer& a_logBuffer);
+
+	// Calls a_func for every index in [0, a_count), in chunks of a_grainSize, on the calling thread plus as many
+	// pool threads as are not busy running tasks. Returns once every index has been processed; if a_func threw,
+	// the remaining chunks are skipped and the first exception is rethrown here.
+	void ParallelFor(std::size_t a_count, std::size_t a_grainSize, const std::function<void(std::size_t)>& a_func);
+
+	// Runs the tasks on a worker pool. A task waits only for the earlier tasks it conflicts with, so any
+	// two conflicting tasks keep their relative order. If a task throws, no further task is started and the
+	// exception of the first failed task is rethrown here once the running tasks have finished.
+	void Run(const std::vector<Task>& a_tasks);
+}  // namespace PatchScheduler
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+namespace Utils
+{
+	// Patch data per target form, stored in one flat array. While a subsystem prepares, operator[] finds or
+	// appends an entry through a hash index. Freeze() sorts the entries by FormID and drops the index, so the
+	// patch pass walks contiguous memory in the same order on every run instead of in pointer-hash order.
+	template <typename FormT, typename PatchDataT>
+	class PatchTable
+	{
+	public:
+		using key_type = FormT*;
+		using mapped_type = PatchDataT;
+		using value_type = std::pair<FormT*, PatchDataT>;
+		using const_iterator = typename std::vector<value_type>::const_iterator;
+
+		// References stay valid until the next insertion, as with std::vector.
+		PatchDataT& operator[](FormT* a_form)
+		{
+			if (frozen_)
+			{
+				BuildIndex();
+			}
+
+			const auto [it, inserted] = indexMap_.emplace(a_form, entries_.size());
+			if (inserted)
+			{
+				entries_.emplace_back(a_form, PatchDataT{});
+			}
+
+			return entries_[it->second].second;
+		}
+
+		void Freeze()
+		{
+			std::vector<std::pair<std::uint32_t, std::uint32_t>> orderVec;
+			orderVec.reserve(entries_.size());
+
+			for (std::uint32_t entryIndex = 0; entryIndex < entries_.size(); ++entryIndex)
+			{
+				orderVec.emplace_back(entries_[entryIndex].first->GetFormID(), entryIndex);
+			}
+
+			std::sort(orderVec.begin(), orderVec.end());
+
+			std::vector<value_type> sortedEntries;
+			sortedEntries.reserve(entries_.size());
+
+			for (const auto& [formID, entryIndex] : orderVec)
+			{
+				sortedEntries.emplace_back(std::move(entries_[entryIndex]));
+			}
+
+			entries_.swap(sortedEntries);
+			std::unordered_map<FormT*, std::size_t>().swap(indexMap_);
+			frozen_ = true;
+		}
+
+		void reserve(std::size_t a_count)
+		{
+			entries_.reserve(a_count);
+			if (!frozen_)
+			{
+				indexMap_.reserve(a_count);
+			}
+		}
+
+		const_iterator begin() const { return entries_.begin(); }
+		const_iterator end() const { return entries_.end(); }
+		std::size_t size() const { return entries_.size(); }
+		bool empty() const { return entries_.empty(); }
+
+		// Releases the storage as well, since a table is only needed for one prepare and patch pass.
+		void clear()
+		{
+			std::vector<value_type>().swap(entries_);
+			std::unordered_map<FormT*, std::size_t>().swap(indexMap_);
+			frozen_ = false;
+		}
+
+	private:
+		void BuildIndex()
+		{
+			indexMap_.reserve(entries_.size());
+			for (std::size_t entryIndex = 0; entryIndex < entries_.size(); ++entryIndex)
+			{
+				indexMap_.emplace(entries_[entryIndex].first, entryIndex);
+			}
+
+			frozen_ = false;
+		}
+
+		std::vector<value_type> entries_;
+		std::unordered_map<FormT*, std::size_t> indexMap_;
+		bool frozen_ = false;
+	};
+}  // namespace Utils
@@ -16,9 +16,54 @@ namespace Utils
 		return true;
 	}
 
+	struct CaseInsensitiveHash
+	{
+		using is_transparent = void;
+
+		std::size_t operator()(std::string_view a_str) const noexcept
+		{
+			// FNV-1a over the case-folded characters
+			std::size_t hash = 14695981039346656037ull;
+			for (const auto ch : a_str)
+			{
+				hash ^= static_cast<std::size_t>(std::tolower(static_cast<unsigned char>(ch)));
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+	};
+
+	struct CaseInsensitiveEqual
+	{
+		using is_transparent = void;
+
+		bool operator()(std::string_view a_lhs, std::string_view a_rhs) const noexcept
+		{
+			return a_lhs.size() == a_rhs.size() &&
+			       std::equal(a_lhs.begin(), a_lhs.end(), a_rhs.begin(), [](char a_l, char a_r) {
+					   return std::tolower(static_cast<unsigned char>(a_l)) == std::tolower(static_cast<unsigned char>(a_r));
+				   });
+		}
+	};
+
+	struct PluginInfo
+	{
+		bool IsActive;
+		bool IsLight;
+		std::uint8_t CompileIndex;
+		std::uint16_t SmallFileCompileIndex;
+		RE::TESFile* File;
+	};
+
 	std::optional<std::uint32_t> ParseHex(std::string_view a_hexStr);
+	void BuildPluginIndex();
+	const PluginInfo* GetPluginInfo(std::string_view a_pluginName);
+	std::optional<std::uint32_t> GetRuntimeFormID(const PluginInfo& a_pluginInfo, std::uint32_t a_formID);
 	bool IsPluginExists(std::string_view a_pluginName);
 	RE::TESForm* GetFormFromIdentifier(std::string_view pluginName, std::uint32_t formId);
 	RE::TESForm* GetFormFromIdentifier(std::string_view pluginName, std::string_view formIdStr);
 	RE::TESForm* GetFormFromString(std::string_view formStr);
+	void AddPendingForm(std::string_view a_pluginName, std::string_view a_formIdStr);
+	void ResolvePendingForms();
+	void LogFormCacheStatistics();
 }  // namespace Utils
@@ -1,1007 +1,1048 @@
-#include "CObjs.h"
-
-#include <any>
-#include <regex>
-#include <unordered_set>
-
-#include "ConfigUtils.h"
-#include "Parsers.h"
-#include "Utils.h"
-
-namespace CObjs
-{
-	namespace
-	{
-		constexpr std::string_view kTypeName = "ConstructibleObject";
-
-		enum class FilterType
-		{
-			kFormID,
-			kCategoryKeyword
-		};
-
-		std::string_view FilterTypeToString(FilterType a_value)
-		{
-			switch (a_value)
-			{
-			case FilterType::kFormID:
-				return "FilterByFormID";
-			case FilterType::kCategoryKeyword:
-				return "FilterByCategoryKeyword";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		enum class ElementType
-		{
-			kCategories,
-			kComponents,
-			kCreatedObject,
-			kCreatedObjectCount,
-			kWorkbenchKeyword
-		};
-
-		std::string_view ElementTypeToString(ElementType a_value)
-		{
-			switch (a_value)
-			{
-			case ElementType::kCategories:
-				return "Categories";
-			case ElementType::kComponents:
-				return "Components";
-			case ElementType::kCreatedObject:
-				return "CreatedObject";
-			case ElementType::kCreatedObjectCount:
-				return "CreatedObjectCount";
-			case ElementType::kWorkbenchKeyword:
-				return "WorkbenchKeyword";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		enum class OperationType
-		{
-			kClear,
-			kAdd,
-			kDelete
-		};
-
-		std::string_view OperationTypeToString(OperationType a_value)
-		{
-			switch (a_value)
-			{
-			case OperationType::kClear:
-				return "Clear";
-			case OperationType::kAdd:
-				return "Add";
-			case OperationType::kDelete:
-				return "Delete";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		struct ConfigData
-		{
-			struct Operation
-			{
-				struct ComponentData
-				{
-					std::string Form;
-					std::uint32_t Count;
-				};
-
-				OperationType OpType;
-				std::optional<std::any> OpData;
-			};
-
-			FilterType Filter;
-			std::string FilterForm;
-			ElementType Element;
-			std::vector<Operation> Operations;
-			std::optional<std::any> AssignValue;
-		};
-
-		struct PatchData
-		{
-			struct CategoriesData
-			{
-				bool Clear = false;
-				std::unordered_set<RE::BGSKeyword*> AddKeywordSet;
-				std::unordered_set<RE::BGSKeyword*> DeleteKeywordSet;
-			};
-
-			struct ComponentsData
-			{
-				struct Component
-				{
-					RE::TESForm* Form;
-					std::uint32_t Count;
-				};
-
-				bool Clear = false;
-				std::vector<Component> AddComponentVec;
-				std::vector<RE::TESForm*> DeleteComponentVec;
-			};
-
-			std::optional<CategoriesData> Categories;
-			std::optional<ComponentsData> Components;
-			std::optional<RE::TESForm*> CreatedObject;
-			std::optional<std::uint16_t> CreatedObjectCount;
-			std::optional<RE::BGSKeyword*> WorkbenchKeyword;
-		};
-
-		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::BGSKeyword*, std::uint16_t> g_keywordIndexMap;
-		std::unordered_map<RE::BGSConstructibleObject*, PatchData> g_filterByFormIDPatchMap;
-		std::unordered_map<std::uint16_t, PatchData> g_filterByCategoryKeywordPatchMap;
-
-		class CObjParser : public Parsers::Parser<ConfigData>
-		{
-		public:
-			CObjParser(std::string_view a_configPath) : Parsers::Parser<ConfigData>(a_configPath) {}
-
-		protected:
-			std::optional<Parsers::Statement<ConfigData>> ParseExpressionStatement() override
-			{
-				ConfigData configData{};
-
-				if (!ParseFilter(configData))
-				{
-					return std::nullopt;
-				}
-
-				auto token = reader.GetToken();
-				if (token != ".")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				if (!ParseElement(configData))
-				{
-					return std::nullopt;
-				}
-
-				token = reader.Peek();
-				if (token == "=")
-				{
-					if (!ParseAssignment(configData))
-					{
-						return std::nullopt;
-					}
-				}
-				else
-				{
-					do
-					{
-						token = reader.GetToken();
-						if (token != ".")
-						{
-							logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
-							return std::nullopt;
-						}
-
-						if (!ParseOperation(configData))
-						{
-							return std::nullopt;
-						}
-					} while (reader.Peek() == ".");
-				}
-
-				token = reader.GetToken();
-				if (token != ";")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ';'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				return Parsers::Statement<ConfigData>::CreateExpressionStatement(configData);
-			}
-
-			void PrintExpressionStatement(const ConfigData& a_configData, int a_indent) override
-			{
-				auto indent = std::string(a_indent * 4, ' ');
-
-				switch (a_configData.Element)
-				{
-				case ElementType::kCategories:
-					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
-					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
-					{
-						std::string opLog;
-
-						switch (a_configData.Operations[opIndex].OpType)
-						{
-						case OperationType::kClear:
-							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
-							break;
-
-						case OperationType::kAdd:
-						case OperationType::kDelete:
-							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType), std::any_cast<std::string>(a_configData.Operations[opIndex].OpData.value()));
-							break;
-						}
-
-						if (opIndex == a_configData.Operations.size() - 1)
-						{
-							opLog += ";";
-						}
-
-						logger::info("{}    {}", indent, opLog);
-					}
-					break;
-
-				case ElementType::kComponents:
-					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
-					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
-					{
-						std::string opLog;
-
-						switch (a_configData.Operations[opIndex].OpType)
-						{
-						case OperationType::kClear:
-							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
-							break;
-
-						case OperationType::kAdd:
-							opLog = fmt::format(".{}({}, {})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<ConfigData::Operation::ComponentData>(a_configData.Operations[opIndex].OpData.value()).Form,
-								std::any_cast<ConfigData::Operation::ComponentData>(a_configData.Operations[opIndex].OpData.value()).Count);
-							break;
-
-						case OperationType::kDelete:
-							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<ConfigData::Operation::ComponentData>(a_configData.Operations[opIndex].OpData.value()).Form);
-							break;
-						}
-
-						if (opIndex == a_configData.Operations.size() - 1)
-						{
-							opLog += ";";
-						}
-
-						logger::info("{}    {}", indent, opLog);
-					}
-					break;
-
-				case ElementType::kCreatedObject:
-				case ElementType::kWorkbenchKeyword:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
-						std::any_cast<std::string>(a_configData.AssignValue.value()));
-					break;
-
-				case ElementType::kCreatedObjectCount:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
-						std::any_cast<std::uint16_t>(a_configData.AssignValue.value()));
-					break;
-				}
-			}
-
-			bool ParseFilter(ConfigData& a_configData)
-			{
-				auto token = reader.GetToken();
-				if (token == "FilterByFormID")
-				{
-					a_configData.Filter = FilterType::kFormID;
-				}
-				else if (token == "FilterByCategoryKeyword")
-				{
-					a_configData.Filter = FilterType::kCategoryKeyword;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				token = reader.GetToken();
-				if (token != "(")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				const auto filterFormOpt = ParseForm();
-				if (!filterFormOpt.has_value())
-				{
-					return false;
-				}
-
-				a_configData.FilterForm = filterFormOpt.value();
-
-				token = reader.GetToken();
-				if (token != ")")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseElement(ConfigData& a_configData)
-			{
-				const auto token = reader.GetToken();
-				if (token == "Categories")
-				{
-					a_configData.Element = ElementType::kCategories;
-				}
-				else if (token == "Components")
-				{
-					a_configData.Element = ElementType::kComponents;
-				}
-				else if (token == "CreatedObject")
-				{
-					a_configData.Element = ElementType::kCreatedObject;
-				}
-				else if (token == "CreatedObjectCount")
-				{
-					a_configData.Element = ElementType::kCreatedObjectCount;
-				}
-				else if (token == "WorkbenchKeyword")
-				{
-					a_configData.Element = ElementType::kWorkbenchKeyword;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid ElementName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseAssignment(ConfigData& a_configData)
-			{
-				auto token = reader.GetToken();
-				if (token != "=")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '='.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				if (a_configData.Element == ElementType::kCreatedObject || a_configData.Element == ElementType::kWorkbenchKeyword)
-				{
-					token = reader.Peek();
-					if (token == "null")
-					{
-						a_configData.AssignValue = std::any(std::string(reader.GetToken()));
-						return true;
-					}
-
-					const auto formOpt = ParseForm();
-					if (!formOpt.has_value())
-					{
-						return false;
-					}
-
-					a_configData.AssignValue = std::any(formOpt.value());
-				}
-				else if (a_configData.Element == ElementType::kCreatedObjectCount)
-				{
-					const auto valueOpt = ParseNumber<std::uint16_t>();
-					if (!valueOpt.has_value())
-					{
-						return false;
-					}
-
-					a_configData.AssignValue = std::any(valueOpt.value());
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid Assignment for '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element));
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseOperation(ConfigData& a_configData)
-			{
-				ConfigData::Operation newOp{};
-
-				auto token = reader.GetToken();
-				if (token == "Clear")
-				{
-					newOp.OpType = OperationType::kClear;
-				}
-				else if (token == "Add")
-				{
-					newOp.OpType = OperationType::kAdd;
-				}
-				else if (token == "Delete")
-				{
-					newOp.OpType = OperationType::kDelete;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
-					if (elem == ElementType::kCategories)
-					{
-						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
-					}
-					else if (elem == ElementType::kComponents)
-					{
-						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
-					}
-					return false;
-				}(a_configData.Element, newOp.OpType);
-
-				if (!isValidOperation)
-				{
-					logger::warn("Line {}, Col {}: Invalid Operation '{}.{}()'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element), OperationTypeToString(newOp.OpType));
-					return false;
-				}
-
-				token = reader.GetToken();
-				if (token != "(")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				switch (a_configData.Element)
-				{
-				case ElementType::kCategories:
-					if (newOp.OpType != OperationType::kClear)
-					{
-						const auto formOpt = ParseForm();
-						if (!formOpt.has_value())
-						{
-							return false;
-						}
-
-						newOp.OpData = std::any(formOpt.value());
-					}
-
-					break;
-
-				case ElementType::kComponents:
-					if (newOp.OpType != OperationType::kClear)
-					{
-						ConfigData::Operation::ComponentData opData{};
-
-						const auto formOpt = ParseForm();
-						if (!formOpt.has_value())
-						{
-							return false;
-						}
-						opData.Form = formOpt.value();
-
-						if (newOp.OpType == OperationType::kAdd)
-						{
-							token = reader.GetToken();
-							if (token != ",")
-							{
-								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
-								return false;
-							}
-
-							const auto countOpt = ParseNumber<std::uint32_t>();
-							if (!countOpt.has_value())
-							{
-								return false;
-							}
-							opData.Count = countOpt.value();
-						}
-
-						newOp.OpData = std::any(opData);
-					}
-
-					break;
-				}
-
-				token = reader.GetToken();
-				if (token != ")")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				a_configData.Operations.emplace_back(newOp);
-
-				return true;
-			}
-		};
-
-		void SetKeywordIndexMap()
-		{
-			const auto keywordsOpt = RE::BGSKeyword::GetTypedKeywords();
-			if (keywordsOpt.has_value())
-			{
-				const auto& arr = (keywordsOpt.value())[RE::stl::to_underlying(RE::KeywordType::kRecipeFilter)];
-				for (std::uint16_t keywordIndex = 0; static_cast<std::uint32_t>(keywordIndex) < arr.size(); ++keywordIndex)
-				{
-					g_keywordIndexMap[arr[keywordIndex]] = keywordIndex;
-				}
-			}
-		}
-
-		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
-		{
-			if (a_configData.Element == ElementType::kCategories)
-			{
-				if (!a_patchData.Categories.has_value())
-				{
-					a_patchData.Categories = PatchData::CategoriesData{};
-				}
-
-				for (const auto& op : a_configData.Operations)
-				{
-					if (op.OpType == OperationType::kClear)
-					{
-						a_patchData.Categories->Clear = true;
-					}
-					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
-					{
-						const auto opForm = std::any_cast<std::string>(op.OpData.value());
-
-						auto* keywordForm = Utils::GetFormFromString(opForm);
-						if (!keywordForm)
-						{
-							logger::warn("Invalid KeywordForm: '{}'.", opForm);
-							continue;
-						}
-
-						auto* keyword = keywordForm->As<RE::BGSKeyword>();
-						if (!keyword)
-						{
-							logger::warn("'{}' is not a Keyword.", opForm);
-							continue;
-						}
-
-						const auto it = g_keywordIndexMap.find(keyword);
-						if (it == g_keywordIndexMap.end())
-						{
-							logger::warn("'{}' is not a recipe filter keyword.", opForm);
-							continue;
-						}
-
-						if (op.OpType == OperationType::kAdd)
-						{
-							a_patchData.Categories->AddKeywordSet.insert(keyword);
-						}
-						else
-						{
-							a_patchData.Categories->DeleteKeywordSet.insert(keyword);
-						}
-					}
-				}
-			}
-			else if (a_configData.Element == ElementType::kComponents)
-			{
-				if (!a_patchData.Components.has_value())
-				{
-					a_patchData.Components = PatchData::ComponentsData{};
-				}
-
-				for (const auto& op : a_configData.Operations)
-				{
-					if (op.OpType == OperationType::kClear)
-					{
-						a_patchData.Components->Clear = true;
-					}
-					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
-					{
-						const auto componentData = std::any_cast<ConfigData::Operation::ComponentData>(op.OpData.value());
-
-						auto* form = Utils::GetFormFromString(componentData.Form);
-						if (!form)
-						{
-							logger::warn("Invalid Form: '{}'.", componentData.Form);
-							continue;
-						}
-
-						if (op.OpType == OperationType::kAdd)
-						{
-							a_patchData.Components->AddComponentVec.emplace_back(PatchData::ComponentsData::Component{ form, componentData.Count });
-						}
-						else
-						{
-							a_patchData.Components->DeleteComponentVec.emplace_back(form);
-						}
-					}
-				}
-			}
-			else if (a_configData.Element == ElementType::kCreatedObject)
-			{
-				const auto formStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-				if (formStr == "null")
-				{
-					a_patchData.CreatedObject = nullptr;
-				}
-				else
-				{
-					auto* form = Utils::GetFormFromString(formStr);
-					if (!form)
-					{
-						logger::warn("Invalid Form: '{}'.", formStr);
-						return;
-					}
-
-					a_patchData.CreatedObject = form;
-				}
-			}
-			else if (a_configData.Element == ElementType::kCreatedObjectCount)
-			{
-				a_patchData.CreatedObjectCount = std::any_cast<std::uint16_t>(a_configData.AssignValue.value());
-			}
-			else if (a_configData.Element == ElementType::kWorkbenchKeyword)
-			{
-				const auto keywordFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-				if (keywordFormStr == "null")
-				{
-					a_patchData.WorkbenchKeyword = nullptr;
-				}
-				else
-				{
-					auto* keywordForm = Utils::GetFormFromString(keywordFormStr);
-					if (!keywordForm)
-					{
-						logger::warn("Invalid Form: '{}'.", keywordFormStr);
-						return;
-					}
-
-					auto* keyword = keywordForm->As<RE::BGSKeyword>();
-					if (!keyword)
-					{
-						logger::warn("'{}' is not a Keyword.", keywordFormStr);
-						return;
-					}
-
-					a_patchData.WorkbenchKeyword = keyword;
-				}
-			}
-		}
-
-		void PrepareFilterByFormID(const ConfigData& a_configData)
-		{
-			auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-			if (!filterForm)
-			{
-				logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-				return;
-			}
-
-			auto* cobjForm = filterForm->As<RE::BGSConstructibleObject>();
-			if (!cobjForm)
-			{
-				logger::warn("'{}' is not a ConstructibleObject", a_configData.FilterForm);
-				return;
-			}
-
-			auto& patchData = g_filterByFormIDPatchMap[cobjForm];
-			PreparePatchData(a_configData, patchData);
-		}
-
-		void PrepareFilterByCategoryKeyword(const ConfigData& a_configData)
-		{
-			auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-			if (!filterForm)
-			{
-				logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-				return;
-			}
-
-			auto* keywordFilterForm = filterForm->As<RE::BGSKeyword>();
-			if (!keywordFilterForm)
-			{
-				logger::warn("'{}' is not a Keyword.", a_configData.FilterForm);
-				return;
-			}
-
-			const auto it = g_keywordIndexMap.find(keywordFilterForm);
-			if (it == g_keywordIndexMap.end())
-			{
-				logger::warn("'{}' is not a recipe filter keyword.", a_configData.FilterForm);
-				return;
-			}
-
-			auto& patchData = g_filterByCategoryKeywordPatchMap[it->second];
-			PreparePatchData(a_configData, patchData);
-		}
-
-		void Prepare(const ConfigData& a_configData)
-		{
-			if (a_configData.Filter == FilterType::kFormID)
-			{
-				PrepareFilterByFormID(a_configData);
-			}
-			else if (a_configData.Filter == FilterType::kCategoryKeyword)
-			{
-				PrepareFilterByCategoryKeyword(a_configData);
-			}
-		}
-
-		std::unordered_set<std::uint16_t> GetCategoryKeywords(RE::BGSConstructibleObject* a_cobjForm)
-		{
-			if (!a_cobjForm || !a_cobjForm->filterKeywords.array || a_cobjForm->filterKeywords.size == 0)
-			{
-				return {};
-			}
-
-			std::unordered_set<std::uint16_t> keywords;
-			keywords.reserve(a_cobjForm->filterKeywords.size);
-
-			for (std::uint32_t keywordIndex = 0; keywordIndex < a_cobjForm->filterKeywords.size; ++keywordIndex)
-			{
-				if (a_cobjForm->filterKeywords.array[keywordIndex].keywordIndex == UINT16_MAX)
-				{
-					continue;
-				}
-
-				keywords.insert(a_cobjForm->filterKeywords.array[keywordIndex].keywordIndex);
-			}
-
-			return keywords;
-		}
-
-		void SetCategoryKeywords(RE::BGSConstructibleObject* a_cobjForm, std::unordered_set<std::uint16_t> a_keywordIndexSet)
-		{
-			if (!a_keywordIndexSet.empty() && (!a_cobjForm->filterKeywords.array || a_cobjForm->filterKeywords.size < a_keywordIndexSet.size()))
-			{
-				using alloc_type = std::remove_pointer_t<decltype(a_cobjForm->filterKeywords.array)>;
-
-				auto* storage = RE::malloc(sizeof(alloc_type) * a_keywordIndexSet.size());
-				if (!storage)
-				{
-					logger::critical("Failed to allocate the ConstructibleObject CategoryKeywords array.");
-					return;
-				}
-
-				if (a_cobjForm->filterKeywords.array)
-				{
-					RE::free(a_cobjForm->filterKeywords.array);
-				}
-
-				a_cobjForm->filterKeywords.array = new (storage) alloc_type[a_keywordIndexSet.size()];
-				a_cobjForm->filterKeywords.size = 0;
-			}
-
-			if (a_keywordIndexSet.empty())
-			{
-				a_cobjForm->filterKeywords.size = 0;
-				return;
-			}
-
-			std::uint32_t index = 0;
-			for (const auto keywordIndex : a_keywordIndexSet)
-			{
-				RE::BGSTypedKeywordValue<RE::KeywordType::kRecipeFilter> newValue{ keywordIndex };
-				a_cobjForm->filterKeywords.array[index++] = newValue;
-			}
-			a_cobjForm->filterKeywords.size = index;
-		}
-
-		void PatchCategories(RE::BGSConstructibleObject* a_cobjForm, const PatchData::CategoriesData& a_categoriesData)
-		{
-			bool cleared = false, deleted = false, added = false;
-			std::unordered_set<std::uint16_t> categoryKeywordIndexSet;
-
-			// Clear
-			if (a_categoriesData.Clear)
-			{
-				cleared = true;
-			}
-			else
-			{
-				categoryKeywordIndexSet = GetCategoryKeywords(a_cobjForm);
-			}
-
-			// Delete
-			if (!cleared && !a_categoriesData.DeleteKeywordSet.empty())
-			{
-				const auto preSize = categoryKeywordIndexSet.size();
-
-				for (const auto& delForm : a_categoriesData.DeleteKeywordSet)
-				{
-					const auto it = g_keywordIndexMap.find(delForm);
-					if (it == g_keywordIndexMap.end())
-					{
-						continue;
-					}
-
-					categoryKeywordIndexSet.erase(it->second);
-				}
-
-				if (preSize != categoryKeywordIndexSet.size())
-				{
-					deleted = true;
-				}
-			}
-
-			if (!a_categoriesData.AddKeywordSet.empty())
-			{
-				const auto preSize = categoryKeywordIndexSet.size();
-
-				// Add
-				for (const auto& addForm : a_categoriesData.AddKeywordSet)
-				{
-					const auto it = g_keywordIndexMap.find(addForm);
-					if (it == g_keywordIndexMap.end())
-					{
-						continue;
-					}
-
-					categoryKeywordIndexSet.insert(it->second);
-				}
-
-				if (preSize != categoryKeywordIndexSet.size())
-				{
-					added = true;
-				}
-			}
-
-			if (cleared || deleted || added)
-			{
-				SetCategoryKeywords(a_cobjForm, categoryKeywordIndexSet);
-			}
-		}
-
-		void PatchComponents(RE::BGSConstructibleObject* a_cobjForm, const PatchData::ComponentsData& a_componentsData)
-		{
-			if (!a_cobjForm->requiredItems)
-			{
-				using alloc_type = std::remove_pointer_t<decltype(a_cobjForm->requiredItems)>;
-
-				auto* storage = RE::malloc(sizeof(alloc_type));
-				if (!storage)
-				{
-					logger::critical("Failed to allocate the ConstructibleObject RequiredItems array.");
-					return;
-				}
-
-				a_cobjForm->requiredItems = new (storage) alloc_type();
-			}
-
-			// Clear
-			if (a_componentsData.Clear)
-			{
-				a_cobjForm->requiredItems->clear();
-			}
-
-			// Delete
-			for (const auto& delForm : a_componentsData.DeleteComponentVec)
-			{
-				for (auto it = a_cobjForm->requiredItems->begin(); it != a_cobjForm->requiredItems->end(); ++it)
-				{
-					if (it->first == delForm)
-					{
-						a_cobjForm->requiredItems->erase(it);
-						break;
-					}
-				}
-			}
-
-			// Add
-			for (const auto& addComponent : a_componentsData.AddComponentVec)
-			{
-				bool found = false;
-
-				for (auto it = a_cobjForm->requiredItems->begin(); it != a_cobjForm->requiredItems->end(); ++it)
-				{
-					if (it->first == addComponent.Form)
-					{
-						found = true;
-						it->second.i = addComponent.Count;
-						break;
-					}
-				}
-
-				if (!found)
-				{
-					a_cobjForm->requiredItems->emplace_back(RE::BSTTuple<RE::TESForm*, RE::BGSTypedFormValuePair::SharedVal>(addComponent.Form, addComponent.Count));
-				}
-			}
-		}
-
-		void Patch(RE::BGSConstructibleObject* a_cobjForm, const PatchData& a_patchData)
-		{
-			if (a_patchData.Categories.has_value())
-			{
-				PatchCategories(a_cobjForm, a_patchData.Categories.value());
-			}
-			if (a_patchData.Components.has_value())
-			{
-				PatchComponents(a_cobjForm, a_patchData.Components.value());
-			}
-			if (a_patchData.CreatedObject.has_value())
-			{
-				a_cobjForm->createdItem = a_patchData.CreatedObject.value();
-			}
-			if (a_patchData.CreatedObjectCount.has_value())
-			{
-				a_cobjForm->data.numConstructed = a_patchData.CreatedObjectCount.value();
-			}
-			if (a_patchData.WorkbenchKeyword.has_value())
-			{
-				a_cobjForm->benchKeyword = a_patchData.WorkbenchKeyword.value();
-			}
-		}
-
-		void PatchByFilters()
-		{
-			auto* dataHandler = RE::TESDataHandler::GetSingleton();
-			if (!dataHandler)
-			{
-				return;
-			}
-
-			if (g_filterByFormIDPatchMap.empty() && g_filterByCategoryKeywordPatchMap.empty())
-			{
-				return;
-			}
-
-			for (auto* form : dataHandler->formArrays[RE::stl::to_underlying(RE::ENUM_FORM_ID::kCOBJ)])
-			{
-				auto* cobjForm = form->As<RE::BGSConstructibleObject>();
-				if (!cobjForm)
-				{
-					continue;
-				}
-
-				const auto filterByFormID_iter = g_filterByFormIDPatchMap.find(cobjForm);
-				if (filterByFormID_iter != g_filterByFormIDPatchMap.end())
-				{
-					Patch(cobjForm, filterByFormID_iter->second);
-				}
-
-				if (!cobjForm->filterKeywords.array || cobjForm->filterKeywords.size == 0)
-				{
-					continue;
-				}
-
-				for (std::uint32_t keywordIndex = 0; keywordIndex < cobjForm->filterKeywords.size; ++keywordIndex)
-				{
-					if (cobjForm->filterKeywords.array[keywordIndex].keywordIndex == UINT16_MAX)
-					{
-						continue;
-					}
-
-					const auto filterByCategoryKeyword_iter = g_filterByCategoryKeywordPatchMap.find(cobjForm->filterKeywords.array[keywordIndex].keywordIndex);
-					if (filterByCategoryKeyword_iter != g_filterByCategoryKeywordPatchMap.end())
-					{
-						Patch(cobjForm, filterByCategoryKeyword_iter->second);
-					}
-				}
-			}
-		}
-	}  // namespace
-
-	void ReadConfigs()
-	{
-		g_configVec = ConfigUtils::ReadConfigs<CObjParser, Parsers::Statement<ConfigData>>(kTypeName);
-	}
-
-	void Patch()
-	{
-		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
-
-		SetKeywordIndexMap();
-		ConfigUtils::Prepare(g_configVec, Prepare);
-
-		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
-		logger::info("");
-
-		logger::info("======================== Start patching for {} ========================", kTypeName);
-
-		PatchByFilters();
-
-		logger::info("======================== Finished patching for {} ========================", kTypeName);
-		logger::info("");
-
-		g_configVec.clear();
-		g_keywordIndexMap.clear();
-		g_filterByFormIDPatchMap.clear();
-		g_filterByCategoryKeywordPatchMap.clear();
-	}
-}  // namespace CObjs
+#include "CObjs.h"
+
+#include <any>
+#include <array>
+#include <bit>
+#include <regex>
+
+#include "ArrayEditor.h"
+#include "ConfigUtils.h"
+#include "Parsers.h"
+#include "PatchTable.h"
+#include "Utils.h"
+
+namespace CObjs
+{
+	namespace
+	{
+		constexpr std::string_view kTypeName = "ConstructibleObject";
+
+		enum class FilterType
+		{
+			kFormID,
+			kEditorID,
+			kEditorIDPattern,
+			kCategoryKeyword
+		};
+
+		std::string_view FilterTypeToString(FilterType a_value)
+		{
+			switch (a_value)
+			{
+			case FilterType::kFormID:
+				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
+			case FilterType::kCategoryKeyword:
+				return "FilterByCategoryKeyword";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		enum class ElementType
+		{
+			kCategories,
+			kComponents,
+			kCreatedObject,
+			kCreatedObjectCount,
+			kWorkbenchKeyword
+		};
+
+		std::string_view ElementTypeToString(ElementType a_value)
+		{
+			switch (a_value)
+			{
+			case ElementType::kCategories:
+				return "Categories";
+			case ElementType::kComponents:
+				return "Components";
+			case ElementType::kCreatedObject:
+				return "CreatedObject";
+			case ElementType::kCreatedObjectCount:
+				return "CreatedObjectCount";
+			case ElementType::kWorkbenchKeyword:
+				return "WorkbenchKeyword";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		enum class OperationType
+		{
+			kClear,
+			kAdd,
+			kDelete
+		};
+
+		std::string_view OperationTypeToString(OperationType a_value)
+		{
+			switch (a_value)
+			{
+			case OperationType::kClear:
+				return "Clear";
+			case OperationType::kAdd:
+				return "Add";
+			case OperationType::kDelete:
+				return "Delete";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		struct ConfigData
+		{
+			struct Operation
+			{
+				struct ComponentData
+				{
+					std::string Form;
+					std::uint32_t Count;
+				};
+
+				OperationType OpType;
+				std::optional<std::any> OpData;
+			};
+
+			FilterType Filter;
+			std::string FilterForm;
+			ElementType Element;
+			std::vector<Operation> Operations;
+			std::optional<std::any> AssignValue;
+		};
+
+		struct PatchData
+		{
+			struct CategoriesData
+			{
+				bool Clear = false;
+				std::vector<std::uint16_t> AddKeywordIndexVec;
+				std::vector<std::uint16_t> DeleteKeywordIndexVec;
+			};
+
+			struct ComponentsData
+			{
+				struct Component
+				{
+					RE::TESForm* Form;
+					std::uint32_t Count;
+				};
+
+				bool Clear = false;
+				std::vector<Component> AddComponentVec;
+				std::vector<RE::TESForm*> DeleteComponentVec;
+			};
+
+			std::optional<CategoriesData> Categories;
+			std::optional<ComponentsData> Components;
+			std::optional<RE::TESForm*> CreatedObject;
+			std::optional<std::uint16_t> CreatedObjectCount;
+			std::optional<RE::BGSKeyword*> WorkbenchKeyword;
+		};
+
+		std::vector<Parsers::Statement<ConfigData>> g_configVec;
+		std::unordered_map<RE::BGSKeyword*, std::uint16_t> g_keywordIndexMap;
+		Utils::PatchTable<RE::BGSConstructibleObject, PatchData> g_filterByFormIDPatchMap;
+		std::unordered_map<std::uint16_t, PatchData> g_filterByCategoryKeywordPatchMap;
+
+		class CObjParser : public Parsers::Parser<ConfigData>
+		{
+		public:
+			CObjParser(std::string_view a_configPath) : Parsers::Parser<ConfigData>(a_configPath) {}
+
+		protected:
+			std::optional<Parsers::Statement<ConfigData>> ParseExpressionStatement() override
+			{
+				ConfigData configData{};
+
+				if (!ParseFilter(configData))
+				{
+					return std::nullopt;
+				}
+
+				auto token = reader.GetToken();
+				if (token != ".")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				if (!ParseElement(configData))
+				{
+					return std::nullopt;
+				}
+
+				token = reader.Peek();
+				if (token == "=")
+				{
+					if (!ParseAssignment(configData))
+					{
+						return std::nullopt;
+					}
+				}
+				else
+				{
+					do
+					{
+						token = reader.GetToken();
+						if (token != ".")
+						{
+							logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
+							return std::nullopt;
+						}
+
+						if (!ParseOperation(configData))
+						{
+							return std::nullopt;
+						}
+					} while (reader.Peek() == ".");
+				}
+
+				token = reader.GetToken();
+				if (token != ";")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ';'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				return Parsers::Statement<ConfigData>::CreateExpressionStatement(configData);
+			}
+
+			void PrintExpressionStatement(const ConfigData& a_configData, int a_indent) override
+			{
+				auto indent = std::string(a_indent * 4, ' ');
+
+				switch (a_configData.Element)
+				{
+				case ElementType::kCategories:
+					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
+					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
+					{
+						std::string opLog;
+
+						switch (a_configData.Operations[opIndex].OpType)
+						{
+						case OperationType::kClear:
+							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
+							break;
+
+						case OperationType::kAdd:
+						case OperationType::kDelete:
+							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType), std::any_cast<std::string>(a_configData.Operations[opIndex].OpData.value()));
+							break;
+						}
+
+						if (opIndex == a_configData.Operations.size() - 1)
+						{
+							opLog += ";";
+						}
+
+						logger::info("{}    {}", indent, opLog);
+					}
+					break;
+
+				case ElementType::kComponents:
+					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
+					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
+					{
+						std::string opLog;
+
+						switch (a_configData.Operations[opIndex].OpType)
+						{
+						case OperationType::kClear:
+							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
+							break;
+
+						case OperationType::kAdd:
+							opLog = fmt::format(".{}({}, {})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<ConfigData::Operation::ComponentData>(a_configData.Operations[opIndex].OpData.value()).Form,
+								std::any_cast<ConfigData::Operation::ComponentData>(a_configData.Operations[opIndex].OpData.value()).Count);
+							break;
+
+						case OperationType::kDelete:
+							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<ConfigData::Operation::ComponentData>(a_configData.Operations[opIndex].OpData.value()).Form);
+							break;
+						}
+
+						if (opIndex == a_configData.Operations.size() - 1)
+						{
+							opLog += ";";
+						}
+
+						logger::info("{}    {}", indent, opLog);
+					}
+					break;
+
+				case ElementType::kCreatedObject:
+				case ElementType::kWorkbenchKeyword:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
+						std::any_cast<std::string>(a_configData.AssignValue.value()));
+					break;
+
+				case ElementType::kCreatedObjectCount:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
+						std::any_cast<std::uint16_t>(a_configData.AssignValue.value()));
+					break;
+				}
+			}
+
+			bool ParseFilter(ConfigData& a_configData)
+			{
+				auto token = reader.GetToken();
+				if (token == "FilterByFormID")
+				{
+					a_configData.Filter = FilterType::kFormID;
+				}
+				else if (token == "FilterByEditorID")
+				{
+					a_configData.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_configData.Filter = FilterType::kEditorIDPattern;
+				}
+				else if (token == "FilterByCategoryKeyword")
+				{
+					a_configData.Filter = FilterType::kCategoryKeyword;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				const auto filterFormOpt = ParseFilterForm(a_configData.Filter);
+				if (!filterFormOpt.has_value())
+				{
+					return false;
+				}
+
+				a_configData.FilterForm = filterFormOpt.value();
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseElement(ConfigData& a_configData)
+			{
+				const auto token = reader.GetToken();
+				if (token == "Categories")
+				{
+					a_configData.Element = ElementType::kCategories;
+				}
+				else if (token == "Components")
+				{
+					a_configData.Element = ElementType::kComponents;
+				}
+				else if (token == "CreatedObject")
+				{
+					a_configData.Element = ElementType::kCreatedObject;
+				}
+				else if (token == "CreatedObjectCount")
+				{
+					a_configData.Element = ElementType::kCreatedObjectCount;
+				}
+				else if (token == "WorkbenchKeyword")
+				{
+					a_configData.Element = ElementType::kWorkbenchKeyword;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid ElementName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseAssignment(ConfigData& a_configData)
+			{
+				auto token = reader.GetToken();
+				if (token != "=")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '='.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				if (a_configData.Element == ElementType::kCreatedObject || a_configData.Element == ElementType::kWorkbenchKeyword)
+				{
+					token = reader.Peek();
+					if (token == "null")
+					{
+						a_configData.AssignValue = std::any(std::string(reader.GetToken()));
+						return true;
+					}
+
+					const auto formOpt = ParseForm();
+					if (!formOpt.has_value())
+					{
+						return false;
+					}
+
+					a_configData.AssignValue = std::any(formOpt.value());
+				}
+				else if (a_configData.Element == ElementType::kCreatedObjectCount)
+				{
+					const auto valueOpt = ParseNumber<std::uint16_t>();
+					if (!valueOpt.has_value())
+					{
+						return false;
+					}
+
+					a_configData.AssignValue = std::any(valueOpt.value());
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid Assignment for '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element));
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseOperation(ConfigData& a_configData)
+			{
+				ConfigData::Operation newOp{};
+
+				auto token = reader.GetToken();
+				if (token == "Clear")
+				{
+					newOp.OpType = OperationType::kClear;
+				}
+				else if (token == "Add")
+				{
+					newOp.OpType = OperationType::kAdd;
+				}
+				else if (token == "Delete")
+				{
+					newOp.OpType = OperationType::kDelete;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
+					if (elem == ElementType::kCategories)
+					{
+						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
+					}
+					else if (elem == ElementType::kComponents)
+					{
+						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
+					}
+					return false;
+				}(a_configData.Element, newOp.OpType);
+
+				if (!isValidOperation)
+				{
+					logger::warn("Line {}, Col {}: Invalid Operation '{}.{}()'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element), OperationTypeToString(newOp.OpType));
+					return false;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				switch (a_configData.Element)
+				{
+				case ElementType::kCategories:
+					if (newOp.OpType != OperationType::kClear)
+					{
+						const auto formOpt = ParseForm();
+						if (!formOpt.has_value())
+						{
+							return false;
+						}
+
+						newOp.OpData = std::any(formOpt.value());
+					}
+
+					break;
+
+				case ElementType::kComponents:
+					if (newOp.OpType != OperationType::kClear)
+					{
+						ConfigData::Operation::ComponentData opData{};
+
+						const auto formOpt = ParseForm();
+						if (!formOpt.has_value())
+						{
+							return false;
+						}
+						opData.Form = formOpt.value();
+
+						if (newOp.OpType == OperationType::kAdd)
+						{
+							token = reader.GetToken();
+							if (token != ",")
+							{
+								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+								return false;
+							}
+
+							const auto countOpt = ParseNumber<std::uint32_t>();
+							if (!countOpt.has_value())
+							{
+								return false;
+							}
+							opData.Count = countOpt.value();
+						}
+
+						newOp.OpData = std::any(opData);
+					}
+
+					break;
+				}
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				a_configData.Operations.emplace_back(newOp);
+
+				return true;
+			}
+		};
+
+		void SetKeywordIndexMap()
+		{
+			const auto keywordsOpt = RE::BGSKeyword::GetTypedKeywords();
+			if (keywordsOpt.has_value())
+			{
+				const auto& arr = (keywordsOpt.value())[RE::stl::to_underlying(RE::KeywordType::kRecipeFilter)];
+				for (std::uint16_t keywordIndex = 0; static_cast<std::uint32_t>(keywordIndex) < arr.size(); ++keywordIndex)
+				{
+					g_keywordIndexMap[arr[keywordIndex]] = keywordIndex;
+				}
+			}
+		}
+
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
+		{
+			if (a_configData.Element == ElementType::kCategories)
+			{
+				if (!a_patchData.Categories.has_value())
+				{
+					a_patchData.Categories = PatchData::CategoriesData{};
+				}
+
+				for (const auto& op : a_configData.Operations)
+				{
+					if (op.OpType == OperationType::kClear)
+					{
+						a_patchData.Categories->Clear = true;
+					}
+					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
+					{
+						const auto opForm = std::any_cast<std::string>(op.OpData.value());
+
+						auto* keywordForm = Utils::GetFormFromString(opForm);
+						if (!keywordForm)
+						{
+							logger::warn("Invalid KeywordForm: '{}'.", opForm);
+							continue;
+						}
+
+						auto* keyword = keywordForm->As<RE::BGSKeyword>();
+						if (!keyword)
+						{
+							logger::warn("'{}' is not a Keyword.", opForm);
+							continue;
+						}
+
+						const auto it = g_keywordIndexMap.find(keyword);
+						if (it == g_keywordIndexMap.end())
+						{
+							logger::warn("'{}' is not a recipe filter keyword.", opForm);
+							continue;
+						}
+
+						if (op.OpType == OperationType::kAdd)
+						{
+							a_patchData.Categories->AddKeywordIndexVec.emplace_back(it->second);
+						}
+						else
+						{
+							a_patchData.Categories->DeleteKeywordIndexVec.emplace_back(it->second);
+						}
+					}
+				}
+			}
+			else if (a_configData.Element == ElementType::kComponents)
+			{
+				if (!a_patchData.Components.has_value())
+				{
+					a_patchData.Components = PatchData::ComponentsData{};
+				}
+
+				for (const auto& op : a_configData.Operations)
+				{
+					if (op.OpType == OperationType::kClear)
+					{
+						a_patchData.Components->Clear = true;
+					}
+					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
+					{
+						const auto componentData = std::any_cast<ConfigData::Operation::ComponentData>(op.OpData.value());
+
+						auto* form = Utils::GetFormFromString(componentData.Form);
+						if (!form)
+						{
+							logger::warn("Invalid Form: '{}'.", componentData.Form);
+							continue;
+						}
+
+						if (op.OpType == OperationType::kAdd)
+						{
+							a_patchData.Components->AddComponentVec.emplace_back(PatchData::ComponentsData::Component{ form, componentData.Count });
+						}
+						else
+						{
+							a_patchData.Components->DeleteComponentVec.emplace_back(form);
+						}
+					}
+				}
+			}
+			else if (a_configData.Element == ElementType::kCreatedObject)
+			{
+				const auto formStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (formStr == "null")
+				{
+					a_patchData.CreatedObject = nullptr;
+				}
+				else
+				{
+					auto* form = Utils::GetFormFromString(formStr);
+					if (!form)
+					{
+						logger::warn("Invalid Form: '{}'.", formStr);
+						return;
+					}
+
+					a_patchData.CreatedObject = form;
+				}
+			}
+			else if (a_configData.Element == ElementType::kCreatedObjectCount)
+			{
+				a_patchData.CreatedObjectCount = std::any_cast<std::uint16_t>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kWorkbenchKeyword)
+			{
+				const auto keywordFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (keywordFormStr == "null")
+				{
+					a_patchData.WorkbenchKeyword = nullptr;
+				}
+				else
+				{
+					auto* keywordForm = Utils::GetFormFromString(keywordFormStr);
+					if (!keywordForm)
+					{
+						logger::warn("Invalid Form: '{}'.", keywordFormStr);
+						return;
+					}
+
+					auto* keyword = keywordForm->As<RE::BGSKeyword>();
+					if (!keyword)
+					{
+						logger::warn("'{}' is not a Keyword.", keywordFormStr);
+						return;
+					}
+
+					a_patchData.WorkbenchKeyword = keyword;
+				}
+			}
+		}
+
+		void PrepareFilterByForm(const ConfigData& a_configData)
+		{
+			for (auto* cobjForm : ConfigUtils::GetFilteredForms<RE::BGSConstructibleObject>(a_configData, "a ConstructibleObject"))
+			{
+				auto& patchData = g_filterByFormIDPatchMap[cobjForm];
+				PreparePatchData(a_configData, patchData);
+			}
+		}
+
+		void PrepareFilterByCategoryKeyword(const ConfigData& a_configData)
+		{
+			auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
+			if (!filterForm)
+			{
+				logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
+				return;
+			}
+
+			auto* keywordFilterForm = filterForm->As<RE::BGSKeyword>();
+			if (!keywordFilterForm)
+			{
+				logger::warn("'{}' is not a Keyword.", a_configData.FilterForm);
+				return;
+			}
+
+			const auto it = g_keywordIndexMap.find(keywordFilterForm);
+			if (it == g_keywordIndexMap.end())
+			{
+				logger::warn("'{}' is not a recipe filter keyword.", a_configData.FilterForm);
+				return;
+			}
+
+			auto& patchData = g_filterByCategoryKeywordPatchMap[it->second];
+			PreparePatchData(a_configData, patchData);
+		}
+
+		void Prepare(const ConfigData& a_configData)
+		{
+			if (a_configData.Filter == FilterType::kCategoryKeyword)
+			{
+				PrepareFilterByCategoryKeyword(a_configData);
+			}
+			else
+			{
+				PrepareFilterByForm(a_configData);
+			}
+		}
+
+		// Recipe filter keyword indices are dense 16-bit values, so a category set is a fixed-size bitset.
+		// Only the words covering the indices in use are cleared and scanned.
+		class CategoryKeywordSet
+		{
+		public:
+			explicit CategoryKeywordSet(std::size_t a_keywordCount)
+			{
+				Grow(a_keywordCount);
+			}
+
+			bool Insert(std::uint16_t a_index)
+			{
+				Grow(static_cast<std::size_t>(a_index) + 1);
+
+				auto& word = words_[a_index >> 6];
+				const auto bit = 1ull << (a_index & 63);
+				const bool inserted = (word & bit) == 0;
+				word |= bit;
+				return inserted;
+			}
+
+			bool Erase(std::uint16_t a_index)
+			{
+				if ((a_index >> 6) >= wordCount_)
+				{
+					return false;
+				}
+
+				auto& word = words_[a_index >> 6];
+				const auto bit = 1ull << (a_index & 63);
+				const bool erased = (word & bit) != 0;
+				word &= ~bit;
+				return erased;
+			}
+
+			std::size_t Count() const
+			{
+				std::size_t count = 0;
+				for (std::size_t wordIndex = 0; wordIndex < wordCount_; ++wordIndex)
+				{
+					count += static_cast<std::size_t>(std::popcount(words_[wordIndex]));
+				}
+				return count;
+			}
+
+			template <typename Func>
+			void ForEach(Func a_func) const
+			{
+				for (std::size_t wordIndex = 0; wordIndex < wordCount_; ++wordIndex)
+				{
+					for (auto word = words_[wordIndex]; word != 0; word &= word - 1)
+					{
+						a_func(static_cast<std::uint16_t>((wordIndex << 6) + static_cast<std::size_t>(std::countr_zero(word))));
+					}
+				}
+			}
+
+		private:
+			void Grow(std::size_t a_bitCount)
+			{
+				const auto wordCount = (a_bitCount + 63) >> 6;
+				if (wordCount > wordCount_)
+				{
+					std::fill(words_.begin() + wordCount_, words_.begin() + wordCount, 0ull);
+					wordCount_ = wordCount;
+				}
+			}
+
+			std::array<std::uint64_t, (UINT16_MAX + 1) / 64> words_;
+			std::size_t wordCount_ = 0;
+		};
+
+		void GetCategoryKeywords(RE::BGSConstructibleObject* a_cobjForm, CategoryKeywordSet& a_keywordSet)
+		{
+			if (!a_cobjForm || !a_cobjForm->filterKeywords.array || a_cobjForm->filterKeywords.size == 0)
+			{
+				return;
+			}
+
+			for (std::uint32_t keywordIndex = 0; keywordIndex < a_cobjForm->filterKeywords.size; ++keywordIndex)
+			{
+				if (a_cobjForm->filterKeywords.array[keywordIndex].keywordIndex == UINT16_MAX)
+				{
+					continue;
+				}
+
+				a_keywordSet.Insert(a_cobjForm->filterKeywords.array[keywordIndex].keywordIndex);
+			}
+		}
+
+		void SetCategoryKeywords(RE::BGSConstructibleObject* a_cobjForm, const CategoryKeywordSet& a_keywordSet)
+		{
+			const auto keywordCount = a_keywordSet.Count();
+
+			if (keywordCount != 0 && (!a_cobjForm->filterKeywords.array || a_cobjForm->filterKeywords.size < keywordCount))
+			{
+				using alloc_type = std::remove_pointer_t<decltype(a_cobjForm->filterKeywords.array)>;
+
+				auto* storage = RE::malloc(sizeof(alloc_type) * keywordCount);
+				if (!storage)
+				{
+					logger::critical("Failed to allocate the ConstructibleObject CategoryKeywords array.");
+					return;
+				}
+
+				if (a_cobjForm->filterKeywords.array)
+				{
+					RE::free(a_cobjForm->filterKeywords.array);
+				}
+
+				a_cobjForm->filterKeywords.array = new (storage) alloc_type[keywordCount];
+				a_cobjForm->filterKeywords.size = 0;
+			}
+
+			if (keywordCount == 0)
+			{
+				a_cobjForm->filterKeywords.size = 0;
+				return;
+			}
+
+			std::uint32_t index = 0;
+			a_keywordSet.ForEach([&](std::uint16_t a_keywordIndex) {
+				RE::BGSTypedKeywordValue<RE::KeywordType::kRecipeFilter> newValue{ a_keywordIndex };
+				a_cobjForm->filterKeywords.array[index++] = newValue;
+			});
+			a_cobjForm->filterKeywords.size = index;
+		}
+
+		void PatchCategories(RE::BGSConstructibleObject* a_cobjForm, const PatchData::CategoriesData& a_categoriesData)
+		{
+			bool modified = false;
+			CategoryKeywordSet categoryKeywordSet(g_keywordIndexMap.size());
+
+			// Clear
+			if (a_categoriesData.Clear)
+			{
+				modified = true;
+			}
+			else
+			{
+				GetCategoryKeywords(a_cobjForm, categoryKeywordSet);
+
+				// Delete
+				for (const auto keywordIndex : a_categoriesData.DeleteKeywordIndexVec)
+				{
+					modified |= categoryKeywordSet.Erase(keywordIndex);
+				}
+			}
+
+			// Add
+			for (const auto keywordIndex : a_categoriesData.AddKeywordIndexVec)
+			{
+				modified |= categoryKeywordSet.Insert(keywordIndex);
+			}
+
+			if (modified)
+			{
+				SetCategoryKeywords(a_cobjForm, categoryKeywordSet);
+			}
+		}
+
+		void PatchComponents(RE::BGSConstructibleObject* a_cobjForm, const PatchData::ComponentsData& a_componentsData)
+		{
+			if (!a_cobjForm->requiredItems)
+			{
+				using alloc_type = std::remove_pointer_t<decltype(a_cobjForm->requiredItems)>;
+
+				auto* storage = RE::malloc(sizeof(alloc_type));
+				if (!storage)
+				{
+					logger::critical("Failed to allocate the ConstructibleObject RequiredItems array.");
+					return;
+				}
+
+				a_cobjForm->requiredItems = new (storage) alloc_type();
+			}
+
+			Utils::ArrayEditor editor(*a_cobjForm->requiredItems, [](const auto& a_component) { return a_component.first; });
+
+			// Clear
+			if (a_componentsData.Clear)
+			{
+				editor.Clear();
+			}
+
+			// Delete
+			editor.Delete(a_componentsData.DeleteComponentVec);
+
+			// Add
+			for (const auto& addComponent : a_componentsData.AddComponentVec)
+			{
+				editor.Set(RE::BSTTuple<RE::TESForm*, RE::BGSTypedFormValuePair::SharedVal>(addComponent.Form, addComponent.Count));
+			}
+
+			editor.Commit();
+		}
+
+		void Patch(RE::BGSConstructibleObject* a_cobjForm, const PatchData& a_patchData)
+		{
+			if (a_patchData.Categories.has_value())
+			{
+				PatchCategories(a_cobjForm, a_patchData.Categories.value());
+			}
+			if (a_patchData.Components.has_value())
+			{
+				PatchComponents(a_cobjForm, a_patchData.Components.value());
+			}
+			if (a_patchData.CreatedObject.has_value())
+			{
+				a_cobjForm->createdItem = a_patchData.CreatedObject.value();
+			}
+			if (a_patchData.CreatedObjectCount.has_value())
+			{
+				a_cobjForm->data.numConstructed = a_patchData.CreatedObjectCount.value();
+			}
+			if (a_patchData.WorkbenchKeyword.has_value())
+			{
+				a_cobjForm->benchKeyword = a_patchData.WorkbenchKeyword.value();
+			}
+		}
+
+		void PatchByFilters()
+		{
+			// FormID-targeted patches are applied straight from the patch map.
+			for (const auto& [cobjForm, patchData] : g_filterByFormIDPatchMap)
+			{
+				Patch(cobjForm, patchData);
+			}
+
+			if (g_filterByCategoryKeywordPatchMap.empty())
+			{
+				return;
+			}
+
+			auto* dataHandler = RE::TESDataHandler::GetSingleton();
+			if (!dataHandler)
+			{
+				return;
+			}
+
+			// Posting lists from each patched category keyword to the recipes carrying it, built in one pass
+			// before any category patch runs so that patches cannot affect which recipes they apply to.
+			std::unordered_map<std::uint16_t, std::vector<RE::BGSConstructibleObject*>> postingMap;
+			postingMap.reserve(g_filterByCategoryKeywordPatchMap.size());
+
+			for (auto* form : dataHandler->formArrays[RE::stl::to_underlying(RE::ENUM_FORM_ID::kCOBJ)])
+			{
+				auto* cobjForm = form->As<RE::BGSConstructibleObject>();
+				if (!cobjForm || !cobjForm->filterKeywords.array || cobjForm->filterKeywords.size == 0)
+				{
+					continue;
+				}
+
+				for (std::uint32_t keywordIndex = 0; keywordIndex < cobjForm->filterKeywords.size; ++keywordIndex)
+				{
+					const auto categoryKeywordIndex = cobjForm->filterKeywords.array[keywordIndex].keywordIndex;
+					if (categoryKeywordIndex == UINT16_MAX || !g_filterByCategoryKeywordPatchMap.contains(categoryKeywordIndex))
+					{
+						continue;
+					}
+
+					auto& postings = postingMap[categoryKeywordIndex];
+					if (postings.empty() || postings.back() != cobjForm)
+					{
+						postings.emplace_back(cobjForm);
+					}
+				}
+			}
+
+			// Category patches run in ascending keyword index order.
+			std::vector<std::uint16_t> categoryKeywordIndexVec;
+			categoryKeywordIndexVec.reserve(postingMap.size());
+			for (const auto& [categoryKeywordIndex, postings] : postingMap)
+			{
+				categoryKeywordIndexVec.emplace_back(categoryKeywordIndex);
+			}
+			std::sort(categoryKeywordIndexVec.begin(), categoryKeywordIndexVec.end());
+
+			for (const auto categoryKeywordIndex : categoryKeywordIndexVec)
+			{
+				const auto& patchData = g_filterByCategoryKeywordPatchMap.at(categoryKeywordIndex);
+				for (auto* cobjForm : postingMap.at(categoryKeywordIndex))
+				{
+					Patch(cobjForm, patchData);
+				}
+			}
+		}
+	}  // namespace
+
+	void ReadConfigs()
+	{
+		g_configVec = ConfigUtils::ReadConfigs<CObjParser, Parsers::Statement<ConfigData>>(kTypeName);
+	}
+
+	void Patch()
+	{
+		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
+
+		SetKeywordIndexMap();
+		ConfigUtils::Prepare(g_configVec, Prepare);
+		g_filterByFormIDPatchMap.Freeze();
+
+		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
+		logger::info("");
+
+		logger::info("======================== Start patching for {} ========================", kTypeName);
+
+		PatchByFilters();
+
+		logger::info("======================== Finished patching for {} ========================", kTypeName);
+		logger::info("");
+
+		g_configVec.clear();
+		g_keywordIndexMap.clear();
+		g_filterByFormIDPatchMap.clear();
+		g_filterByCategoryKeywordPatchMap.clear();
+	}
+}  // namespace CObjs
@@ -4,6 +4,7 @@
 #include <regex>
 
 #include "ConfigUtils.h"
+#include "PatchTable.h"
 
 namespace CombatStyles
 {
@@ -13,7 +14,9 @@ namespace CombatStyles
 
 		enum class FilterType
 		{
-			kFormID
+			kFormID,
+			kEditorID,
+			kEditorIDPattern
 		};
 
 		std::string_view FilterTypeToString(FilterType a_value)
@@ -22,6 +25,10 @@ namespace CombatStyles
 			{
 			case FilterType::kFormID:
 				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
 			default:
 				return std::string_view{};
 			}
@@ -249,7 +256,7 @@ namespace CombatStyles
 		};
 
 		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::TESCombatStyle*, PatchData> g_patchMap;
+		Utils::PatchTable<RE::TESCombatStyle, PatchData> g_patchMap;
 
 		class CombatStyleParser : public Parsers::Parser<ConfigData>
 		{
@@ -365,6 +372,14 @@ namespace CombatStyles
 				{
 					a_configData.Filter = FilterType::kFormID;
 				}
+				else if (token == "FilterByEditorID")
+				{
+					a_configData.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_configData.Filter = FilterType::kEditorIDPattern;
+				}
 				else
 				{
 					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
@@ -378,7 +393,7 @@ namespace CombatStyles
 					return false;
 				}
 
-				const auto filterFormOpt = ParseForm();
+				const auto filterFormOpt = ParseFilterForm(a_configData.Filter);
 				if (!filterFormOpt.has_value())
 				{
 					return false;
@@ -790,228 +805,214 @@ namespace CombatStyles
 			}
 		};
 
-		void Prepare(const ConfigData& a_configData)
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
 		{
-			if (a_configData.Filter == FilterType::kFormID)
+			if (a_configData.Element == ElementType::kOffensiveMult)
 			{
-				auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-				if (!filterForm)
-				{
-					logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-					return;
-				}
-
-				auto* combatStyle = filterForm->As<RE::TESCombatStyle>();
-				if (!combatStyle)
-				{
-					logger::warn("'{}' is not a CombatStyle.", a_configData.FilterForm);
-					return;
-				}
-
-				auto& patchData = g_patchMap[combatStyle];
-
-				if (a_configData.Element == ElementType::kOffensiveMult)
-				{
-					patchData.OffensiveMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kDefensiveMult)
-				{
-					patchData.DefensiveMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kGroupOffensiveMult)
-				{
-					patchData.GroupOffensiveMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kMeleeEquipmentScoreMult)
-				{
-					patchData.MeleeEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kMagicEquipmentScoreMult)
-				{
-					patchData.MagicEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kRangedEquipmentScoreMult)
-				{
-					patchData.RangedEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kShoutEquipmentScoreMult)
-				{
-					patchData.ShoutEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kUnarmedEquipmentScoreMult)
-				{
-					patchData.UnarmedEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kStaffEquipmentScoreMult)
-				{
-					patchData.StaffEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kAvoidThreatChance)
-				{
-					patchData.AvoidThreatChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kDodgeThreatChance)
-				{
-					patchData.DodgeThreatChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kEvadeThreatChance)
-				{
-					patchData.EvadeThreatChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kAttackStaggeredMult)
-				{
-					patchData.AttackStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kPowerAttackStaggeredMult)
-				{
-					patchData.PowerAttackStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kPowerAttackBlockingMult)
-				{
-					patchData.PowerAttackBlockingMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kBashMult)
-				{
-					patchData.BashMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kBashRecoilMult)
-				{
-					patchData.BashRecoilMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kBashAttackMult)
-				{
-					patchData.BashAttackMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kBashPowerAttackMult)
-				{
-					patchData.BashPowerAttackMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kSpecialAttackMult)
-				{
-					patchData.SpecialAttackMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kBlockWhenStaggeredMult)
-				{
-					patchData.BlockWhenStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kAttackWhenStaggeredMult)
-				{
-					patchData.AttackWhenStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kRangedAccuracyMult)
-				{
-					patchData.RangedAccuracyMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kCircleMult)
-				{
-					patchData.CircleMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFallbackMult)
-				{
-					patchData.FallbackMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFlankDistance)
-				{
-					patchData.FlankDistance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kStalkTime)
-				{
-					patchData.StalkTime = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kChargeDistance)
-				{
-					patchData.ChargeDistance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kThrowProbability)
-				{
-					patchData.ThrowProbability = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kSprintFastProbability)
-				{
-					patchData.SprintFastProbability = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kSideswipeProbability)
-				{
-					patchData.SideswipeProbability = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kDisengageProbability)
-				{
-					patchData.DisengageProbability = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kThrowMaxTargets)
-				{
-					patchData.ThrowMaxTargets = std::any_cast<std::uint32_t>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFlankVariance)
-				{
-					patchData.FlankVariance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kStrafeMult)
-				{
-					patchData.StrafeMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kAdjustRangeMult)
-				{
-					patchData.AdjustRangeMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kCrouchMult)
-				{
-					patchData.CrouchMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kWaitMult)
-				{
-					patchData.WaitMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kRangeMult)
-				{
-					patchData.RangeMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kCoverSearchDistanceMult)
-				{
-					patchData.CoverSearchDistanceMult = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kHoverChance)
-				{
-					patchData.HoverChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kDiveBombChance)
-				{
-					patchData.DiveBombChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kGroundAttackChance)
-				{
-					patchData.GroundAttackChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kHoverTime)
-				{
-					patchData.HoverTime = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kGroundAttackTime)
-				{
-					patchData.GroundAttackTime = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kPerchAttackChance)
-				{
-					patchData.PerchAttackChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kPerchAttackTime)
-				{
-					patchData.PerchAttackTime = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFlyingAttackChance)
-				{
-					patchData.FlyingAttackChance = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFlags)
-				{
-					patchData.Flags = std::any_cast<std::uint32_t>(a_configData.AssignValue.value());
-				}
-				else
-				{
-					logger::warn("Invalid ElementName: '{}'.", ElementTypeToString(a_configData.Element));
-					return;
-				}
+				a_patchData.OffensiveMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kDefensiveMult)
+			{
+				a_patchData.DefensiveMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kGroupOffensiveMult)
+			{
+				a_patchData.GroupOffensiveMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kMeleeEquipmentScoreMult)
+			{
+				a_patchData.MeleeEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kMagicEquipmentScoreMult)
+			{
+				a_patchData.MagicEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kRangedEquipmentScoreMult)
+			{
+				a_patchData.RangedEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kShoutEquipmentScoreMult)
+			{
+				a_patchData.ShoutEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kUnarmedEquipmentScoreMult)
+			{
+				a_patchData.UnarmedEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kStaffEquipmentScoreMult)
+			{
+				a_patchData.StaffEquipmentScoreMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kAvoidThreatChance)
+			{
+				a_patchData.AvoidThreatChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kDodgeThreatChance)
+			{
+				a_patchData.DodgeThreatChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kEvadeThreatChance)
+			{
+				a_patchData.EvadeThreatChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kAttackStaggeredMult)
+			{
+				a_patchData.AttackStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kPowerAttackStaggeredMult)
+			{
+				a_patchData.PowerAttackStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kPowerAttackBlockingMult)
+			{
+				a_patchData.PowerAttackBlockingMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kBashMult)
+			{
+				a_patchData.BashMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kBashRecoilMult)
+			{
+				a_patchData.BashRecoilMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kBashAttackMult)
+			{
+				a_patchData.BashAttackMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kBashPowerAttackMult)
+			{
+				a_patchData.BashPowerAttackMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kSpecialAttackMult)
+			{
+				a_patchData.SpecialAttackMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kBlockWhenStaggeredMult)
+			{
+				a_patchData.BlockWhenStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kAttackWhenStaggeredMult)
+			{
+				a_patchData.AttackWhenStaggeredMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kRangedAccuracyMult)
+			{
+				a_patchData.RangedAccuracyMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kCircleMult)
+			{
+				a_patchData.CircleMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kFallbackMult)
+			{
+				a_patchData.FallbackMult = std::any_cast<float>(a_configData.AssignValue.value());
 			}
+			else if (a_configData.Element == ElementType::kFlankDistance)
+			{
+				a_patchData.FlankDistance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kStalkTime)
+			{
+				a_patchData.StalkTime = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kChargeDistance)
+			{
+				a_patchData.ChargeDistance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kThrowProbability)
+			{
+				a_patchData.ThrowProbability = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kSprintFastProbability)
+			{
+				a_patchData.SprintFastProbability = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kSideswipeProbability)
+			{
+				a_patchData.SideswipeProbability = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kDisengageProbability)
+			{
+				a_patchData.DisengageProbability = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kThrowMaxTargets)
+			{
+				a_patchData.ThrowMaxTargets = std::any_cast<std::uint32_t>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kFlankVariance)
+			{
+				a_patchData.FlankVariance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kStrafeMult)
+			{
+				a_patchData.StrafeMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kAdjustRangeMult)
+			{
+				a_patchData.AdjustRangeMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kCrouchMult)
+			{
+				a_patchData.CrouchMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kWaitMult)
+			{
+				a_patchData.WaitMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kRangeMult)
+			{
+				a_patchData.RangeMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kCoverSearchDistanceMult)
+			{
+				a_patchData.CoverSearchDistanceMult = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kHoverChance)
+			{
+				a_patchData.HoverChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kDiveBombChance)
+			{
+				a_patchData.DiveBombChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kGroundAttackChance)
+			{
+				a_patchData.GroundAttackChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kHoverTime)
+			{
+				a_patchData.HoverTime = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kGroundAttackTime)
+			{
+				a_patchData.GroundAttackTime = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kPerchAttackChance)
+			{
+				a_patchData.PerchAttackChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kPerchAttackTime)
+			{
+				a_patchData.PerchAttackTime = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kFlyingAttackChance)
+			{
+				a_patchData.FlyingAttackChance = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kFlags)
+			{
+				a_patchData.Flags = std::any_cast<std::uint32_t>(a_configData.AssignValue.value());
+			}
+			else
+			{
+				logger::warn("Invalid ElementName: '{}'.", ElementTypeToString(a_configData.Element));
+				return;
+			}
+		}
+
+		std::vector<RE::TESCombatStyle*> GetTargets(const ConfigData& a_configData)
+		{
+			return ConfigUtils::GetFilteredForms<RE::TESCombatStyle>(a_configData, "a CombatStyle");
 		}
 	}  // namespace
 
@@ -1024,7 +1025,8 @@ namespace CombatStyles
 	{
 		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
 
-		ConfigUtils::Prepare(g_configVec, Prepare);
+		ConfigUtils::Prepare(g_configVec, g_patchMap, GetTargets, PreparePatchData);
+		g_patchMap.Freeze();
 
 		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
 		logger::info("");
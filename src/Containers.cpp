@@ -1,9 +1,11 @@
 #include "Containers.h"
 
 #include <regex>
+#include <unordered_set>
 
 #include "ConfigUtils.h"
 #include "Parsers.h"
+#include "PatchTable.h"
 #include "Utils.h"
 
 namespace Containers
@@ -14,7 +16,11 @@ namespace Containers
 
 		enum class FilterType
 		{
-			kFormID
+			kFormID,
+			kEditorID,
+			kEditorIDPattern,
+			kPlugin,
+			kPredicates
 		};
 
 		std::string_view FilterTypeToString(FilterType a_value)
@@ -23,6 +29,14 @@ namespace Containers
 			{
 			case FilterType::kFormID:
 				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
+			case FilterType::kPlugin:
+				return "FilterByPlugin";
+			case FilterType::kPredicates:
+				return "FilterByPredicates";
 			default:
 				return std::string_view{};
 			}
@@ -52,7 +66,8 @@ namespace Containers
 			kClear,
 			kAdd,
 			kDelete,
-			kDeleteAll
+			kDeleteAll,
+			kCoalesce
 		};
 
 		std::string_view OperationTypeToString(OperationType a_value)
@@ -67,6 +82,8 @@ namespace Containers
 				return "Delete";
 			case OperationType::kDeleteAll:
 				return "DeleteAll";
+			case OperationType::kCoalesce:
+				return "Coalesce";
 			default:
 				return std::string_view{};
 			}
@@ -101,9 +118,11 @@ namespace Containers
 				{
 					RE::TESBoundObject* Form;
 					std::uint32_t Count;
+					RE::ContainerObject* Object = nullptr;
 				};
 
 				bool Clear;
+				bool Coalesce;
 				std::vector<Item> AddObjectVec;
 				std::vector<RE::TESBoundObject*> DeleteObjectVec;
 				std::vector<RE::TESBoundObject*> DeleteAllObjectVec;
@@ -114,7 +133,17 @@ namespace Containers
 		};
 
 		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::TESObjectCONT*, PatchData> g_patchMap;
+		Utils::PatchTable<RE::TESObjectCONT, PatchData> g_patchMap;
+
+		std::size_t g_reusedObjectCount = 0;
+		std::size_t g_reusedArrayCount = 0;
+
+		const FormFilters::PredicateContext g_predicateContext{
+			{ RE::ENUM_FORM_ID::kCONT },
+			{
+				{ "ItemCount", [](RE::TESForm* a_form) { return static_cast<float>(static_cast<RE::TESObjectCONT*>(a_form)->numContainerObjects); } },
+			}
+		};
 
 		class ContainerParser : public Parsers::Parser<ConfigData>
 		{
@@ -198,6 +227,7 @@ namespace Containers
 						switch (a_configData.Operations[opIndex].OpType)
 						{
 						case OperationType::kClear:
+						case OperationType::kCoalesce:
 							opLog = std::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
 							break;
 
@@ -229,6 +259,22 @@ namespace Containers
 				{
 					a_config.Filter = FilterType::kFormID;
 				}
+				else if (token == "FilterByEditorID")
+				{
+					a_config.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_config.Filter = FilterType::kEditorIDPattern;
+				}
+				else if (token == "FilterByPlugin")
+				{
+					a_config.Filter = FilterType::kPlugin;
+				}
+				else if (token == "FilterByPredicates")
+				{
+					a_config.Filter = FilterType::kPredicates;
+				}
 				else
 				{
 					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
@@ -242,7 +288,7 @@ namespace Containers
 					return false;
 				}
 
-				const auto filterFormOpt = ParseForm();
+				const auto filterFormOpt = a_config.Filter == FilterType::kPredicates ? ParsePredicates(g_predicateContext) : ParseFilterForm(a_config.Filter);
 				if (!filterFormOpt.has_value())
 				{
 					return false;
@@ -329,6 +375,10 @@ namespace Containers
 				{
 					newOp.OpType = OperationType::kDeleteAll;
 				}
+				else if (token == "Coalesce")
+				{
+					newOp.OpType = OperationType::kCoalesce;
+				}
 				else
 				{
 					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
@@ -338,7 +388,7 @@ namespace Containers
 				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
 					if (elem == ElementType::kItems)
 					{
-						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete || op == OperationType::kDeleteAll;
+						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete || op == OperationType::kDeleteAll || op == OperationType::kCoalesce;
 					}
 					return false;
 				}(a_configData.Element, newOp.OpType);
@@ -358,7 +408,7 @@ namespace Containers
 
 				if (a_configData.Element == ElementType::kItems)
 				{
-					if (newOp.OpType != OperationType::kClear)
+					if (newOp.OpType != OperationType::kClear && newOp.OpType != OperationType::kCoalesce)
 					{
 						ConfigData::Operation::Data opData{};
 
@@ -403,77 +453,67 @@ namespace Containers
 			}
 		};
 
-		void Prepare(const ConfigData& a_configData)
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
 		{
-			if (a_configData.Filter == FilterType::kFormID)
+			if (a_configData.Element == ElementType::kFullName)
 			{
-				auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-				if (!filterForm)
-				{
-					logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-					return;
-				}
-
-				auto* container = filterForm->As<RE::TESObjectCONT>();
-				if (!container)
+				a_patchData.FullName = a_configData.AssignValue.value();
+			}
+			else if (a_configData.Element == ElementType::kItems)
+			{
+				if (!a_patchData.Items.has_value())
 				{
-					logger::warn("'{}' is not a Container.", a_configData.FilterForm);
-					return;
+					a_patchData.Items = PatchData::ItemsData{};
 				}
 
-				auto& patchData = g_patchMap[container];
-
-				if (a_configData.Element == ElementType::kFullName)
+				for (const auto& op : a_configData.Operations)
 				{
-					patchData.FullName = a_configData.AssignValue.value();
-				}
-				else if (a_configData.Element == ElementType::kItems)
-				{
-					if (!patchData.Items.has_value())
+					if (op.OpType == OperationType::kClear)
 					{
-						patchData.Items = PatchData::ItemsData{};
+						a_patchData.Items->Clear = true;
 					}
-
-					for (const auto& op : a_configData.Operations)
+					else if (op.OpType == OperationType::kCoalesce)
+					{
+						a_patchData.Items->Coalesce = true;
+					}
+					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete || op.OpType == OperationType::kDeleteAll)
 					{
-						if (op.OpType == OperationType::kClear)
+						auto* opForm = Utils::GetFormFromString(op.OpData->Form);
+						if (!opForm)
 						{
-							patchData.Items->Clear = true;
+							logger::warn("Invalid Form: '{}'.", op.OpData->Form);
+							continue;
 						}
-						else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete || op.OpType == OperationType::kDeleteAll)
-						{
-							auto* opForm = Utils::GetFormFromString(op.OpData->Form);
-							if (!opForm)
-							{
-								logger::warn("Invalid Form: '{}'.", op.OpData->Form);
-								continue;
-							}
 
-							auto* boundObj = opForm->As<RE::TESBoundObject>();
-							if (!boundObj)
-							{
-								logger::warn("'{}' is not a valid bound object.", op.OpData->Form);
-								continue;
-							}
+						auto* boundObj = opForm->As<RE::TESBoundObject>();
+						if (!boundObj)
+						{
+							logger::warn("'{}' is not a valid bound object.", op.OpData->Form);
+							continue;
+						}
 
-							if (op.OpType == OperationType::kAdd)
-							{
-								patchData.Items->AddObjectVec.emplace_back(PatchData::ItemsData::Item{ boundObj, op.OpData->Count });
-							}
-							else if (op.OpType == OperationType::kDelete)
-							{
-								patchData.Items->DeleteObjectVec.emplace_back(boundObj);
-							}
-							else if (op.OpType == OperationType::kDeleteAll)
-							{
-								patchData.Items->DeleteAllObjectVec.emplace_back(boundObj);
-							}
+						if (op.OpType == OperationType::kAdd)
+						{
+							a_patchData.Items->AddObjectVec.emplace_back(PatchData::ItemsData::Item{ boundObj, op.OpData->Count });
+						}
+						else if (op.OpType == OperationType::kDelete)
+						{
+							a_patchData.Items->DeleteObjectVec.emplace_back(boundObj);
+						}
+						else if (op.OpType == OperationType::kDeleteAll)
+						{
+							a_patchData.Items->DeleteAllObjectVec.emplace_back(boundObj);
 						}
 					}
 				}
 			}
 		}
 
+		std::vector<RE::TESObjectCONT*> GetTargets(const ConfigData& a_configData)
+		{
+			return ConfigUtils::GetFilteredForms<RE::TESObjectCONT>(a_configData, "a Container");
+		}
+
 		std::vector<PatchData::ItemsData::Item> GetContainerEntries(RE::TESObjectCONT* a_container)
 		{
 			if (!a_container || !a_container->containerObjects || a_container->numContainerObjects == 0)
@@ -489,6 +529,7 @@ namespace Containers
 				auto& item = entries.emplace_back();
 				item.Form = a_container->containerObjects[contIndex]->obj;
 				item.Count = static_cast<std::uint32_t>(a_container->containerObjects[contIndex]->count);
+				item.Object = a_container->containerObjects[contIndex];
 			}
 
 			return entries;
@@ -509,7 +550,9 @@ namespace Containers
 			RE::free(a_items);
 		}
 
-		void SetItems(RE::TESObjectCONT* a_container, const std::vector<PatchData::ItemsData::Item>& a_items)
+		// Existing ContainerObjects of surviving items are updated in place, and the pointer array is
+		// reused when it does not grow. Only genuinely new items and dropped objects touch the heap.
+		void SetItems(RE::TESObjectCONT* a_container, std::vector<PatchData::ItemsData::Item>& a_items)
 		{
 			if (a_items.empty())
 			{
@@ -519,34 +562,142 @@ namespace Containers
 				return;
 			}
 
-			auto** newItems = static_cast<RE::ContainerObject**>(RE::malloc(sizeof(RE::ContainerObject*) * a_items.size()));
-			if (!newItems)
-			{
-				logger::error("Failed to allocate the ContainerObject array.");
-				return;
-			}
-
-			std::uint32_t actualCount = 0;
+			// Allocate new objects before touching the container so a failure leaves it intact.
+			std::vector<RE::ContainerObject*> newObjects;
 			for (const auto& entry : a_items)
 			{
+				if (entry.Object)
+				{
+					continue;
+				}
+
 				auto* newItem = static_cast<RE::ContainerObject*>(RE::malloc(sizeof(RE::ContainerObject)));
 				if (!newItem)
 				{
 					logger::error("Failed to allocate a ContainerObject.");
-					FreeItems(newItems, actualCount);
+					for (auto* newObject : newObjects)
+					{
+						RE::free(newObject);
+					}
 					return;
 				}
 
-				newItems[actualCount++] = ::new (newItem) RE::ContainerObject(entry.Form, static_cast<std::int32_t>(entry.Count));
+				newObjects.emplace_back(::new (newItem) RE::ContainerObject(entry.Form, static_cast<std::int32_t>(entry.Count)));
 			}
 
 			auto** oldItems = a_container->containerObjects;
 			const auto oldItemCount = a_container->numContainerObjects;
 
+			const bool reuseArray = oldItems && a_items.size() <= oldItemCount;
+
+			auto** newItems = reuseArray ? oldItems : static_cast<RE::ContainerObject**>(RE::malloc(sizeof(RE::ContainerObject*) * a_items.size()));
+			if (!newItems)
+			{
+				logger::error("Failed to allocate the ContainerObject array.");
+				for (auto* newObject : newObjects)
+				{
+					RE::free(newObject);
+				}
+				return;
+			}
+
+			// Release the old objects that no surviving item refers to.
+			if (oldItems)
+			{
+				std::unordered_set<RE::ContainerObject*> keptObjectSet;
+				keptObjectSet.reserve(a_items.size());
+				for (const auto& entry : a_items)
+				{
+					if (entry.Object)
+					{
+						keptObjectSet.insert(entry.Object);
+					}
+				}
+
+				for (std::uint32_t itemIndex = 0; itemIndex < oldItemCount; ++itemIndex)
+				{
+					if (!keptObjectSet.contains(oldItems[itemIndex]))
+					{
+						RE::free(oldItems[itemIndex]);
+					}
+				}
+			}
+
+			std::uint32_t actualCount = 0;
+			std::size_t newObjectIndex = 0;
+			for (auto& entry : a_items)
+			{
+				if (entry.Object)
+				{
+					entry.Object->obj = entry.Form;
+					entry.Object->count = static_cast<std::int32_t>(entry.Count);
+					newItems[actualCount++] = entry.Object;
+					++g_reusedObjectCount;
+				}
+				else
+				{
+					newItems[actualCount++] = newObjects[newObjectIndex++];
+				}
+			}
+
 			a_container->containerObjects = newItems;
 			a_container->numContainerObjects = actualCount;
 
-			FreeItems(oldItems, oldItemCount);
+			if (reuseArray)
+			{
+				++g_reusedArrayCount;
+			}
+			else if (oldItems)
+			{
+				RE::free(oldItems);
+			}
+		}
+
+		RE::ContainerItemExtra* GetItemExtra(const PatchData::ItemsData::Item& a_item)
+		{
+			return a_item.Object ? a_item.Object->itemExtra : nullptr;
+		}
+
+		// Merges adjacent entries of the same form in the sorted items into one entry with the summed count.
+		// Entries whose extra data differs carry their own health or condition, so they are left apart.
+		bool CoalesceItems(std::vector<PatchData::ItemsData::Item>& a_items)
+		{
+			if (a_items.size() < 2)
+			{
+				return false;
+			}
+
+			std::size_t writeIndex = 0;
+			for (std::size_t readIndex = 1; readIndex < a_items.size(); ++readIndex)
+			{
+				auto& merged = a_items[writeIndex];
+				auto& item = a_items[readIndex];
+
+				if (item.Form != merged.Form || GetItemExtra(item) != GetItemExtra(merged))
+				{
+					a_items[++writeIndex] = item;
+					continue;
+				}
+
+				const auto count = static_cast<std::uint64_t>(merged.Count) + item.Count;
+				merged.Count = static_cast<std::uint32_t>(std::min<std::uint64_t>(count, static_cast<std::uint64_t>(INT32_MAX)));
+
+				// Keep an existing allocation so SetItems can reuse it.
+				if (!merged.Object)
+				{
+					merged.Object = item.Object;
+				}
+			}
+
+			const auto coalescedCount = writeIndex + 1;
+			if (coalescedCount == a_items.size())
+			{
+				return false;
+			}
+
+			a_items.resize(coalescedCount);
+
+			return true;
 		}
 
 		void PatchItems(RE::TESObjectCONT* a_container, const PatchData::ItemsData& a_itemsData)
@@ -609,6 +760,12 @@ namespace Containers
 				return a.Form->formID < b.Form->formID;
 			});
 
+			// Coalesce
+			if (a_itemsData.Coalesce && CoalesceItems(items))
+			{
+				modified = true;
+			}
+
 			if (cleared || modified)
 			{
 				SetItems(a_container, items);
@@ -625,7 +782,8 @@ namespace Containers
 	{
 		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
 
-		ConfigUtils::Prepare(g_configVec, Prepare);
+		ConfigUtils::Prepare(g_configVec, g_patchMap, GetTargets, PreparePatchData);
+		g_patchMap.Freeze();
 
 		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
 		logger::info("");
@@ -645,10 +803,15 @@ namespace Containers
 			}
 		}
 
+		logger::info("Reused {} ContainerObject allocations and {} item arrays.", g_reusedObjectCount, g_reusedArrayCount);
+
 		logger::info("======================== Finished patching for {} ========================", kTypeName);
 		logger::info("");
 
 		g_configVec.clear();
 		g_patchMap.clear();
+
+		g_reusedObjectCount = 0;
+		g_reusedArrayCount = 0;
 	}
 }  // namespace Containers
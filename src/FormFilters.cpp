@@ -0,0 +1,834 @@
+#include "FormFilters.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <srell.hpp>
+
+#include "Utils.h"
+
+namespace FormFilters
+{
+	namespace
+	{
+		using EditorIDMap = std::unordered_map<std::string, RE::TESForm*, Utils::CaseInsensitiveHash, Utils::CaseInsensitiveEqual>;
+		using PatternMatchMap = std::unordered_map<std::string, std::vector<RE::TESForm*>>;
+
+		// Every EditorID pattern used by any config. All of them are compiled into one matcher per scanned form type.
+		std::vector<std::string> g_editorIDPatterns;
+
+		// Built lazily, only for the form types that an EditorID filter actually queries.
+		std::unordered_map<RE::ENUM_FORM_ID, EditorIDMap> g_editorIDIndexMap;
+		std::unordered_map<RE::ENUM_FORM_ID, PatternMatchMap> g_patternMatchMap;
+
+		// Predicate filters registered while parsing, keyed by form type and the filter's canonical text.
+		std::unordered_map<RE::ENUM_FORM_ID, std::unordered_map<std::string, std::vector<Predicate>>> g_predicateFilterMap;
+		std::unordered_map<RE::ENUM_FORM_ID, PatternMatchMap> g_predicateMatchMap;
+
+		// Keyword expressions in postfix order, keyed by their canonical text.
+		std::unordered_map<std::string, std::vector<KeywordToken>> g_keywordFilterMap;
+		std::unordered_map<RE::ENUM_FORM_ID, PatternMatchMap> g_keywordMatchMap;
+
+		struct PluginFilter
+		{
+			std::string PluginName;
+			bool Overridden;
+			bool Reported = false;
+		};
+
+		// FilterByPlugin statements keyed by their canonical text.
+		std::unordered_map<std::string, PluginFilter> g_pluginFilterMap;
+		std::unordered_map<RE::ENUM_FORM_ID, PatternMatchMap> g_pluginMatchMap;
+
+		// Per form type, every form sorted by FormID, so a plugin's forms are one contiguous range.
+		std::unordered_map<RE::ENUM_FORM_ID, std::vector<RE::TESForm*>> g_sortedFormArrayMap;
+
+		// Guards the lazily built per-form-type caches above, which are queried concurrently. A cache entry is
+		// never modified once built and never erased before Clear(), so it can be read after unlocking.
+		std::shared_mutex g_cacheMutex;
+
+		// Keyword -> ascending indices into the form type's form array.
+		using KeywordPostingMap = std::unordered_map<RE::BGSKeyword*, std::vector<std::uint32_t>>;
+
+		const RE::BSTArray<RE::TESForm*>* GetFormArray(RE::ENUM_FORM_ID a_formType)
+		{
+			auto* g_dataHandler = RE::TESDataHandler::GetSingleton();
+			if (!g_dataHandler)
+			{
+				return nullptr;
+			}
+
+			return std::addressof(g_dataHandler->formArrays[RE::stl::to_underlying(a_formType)]);
+		}
+
+		std::string_view GetEditorID(const RE::TESForm* a_form)
+		{
+			const auto* editorID = a_form->GetFormEditorID();
+			return editorID ? std::string_view(editorID) : std::string_view{};
+		}
+
+		const EditorIDMap& BuildEditorIDIndex(RE::ENUM_FORM_ID a_formType)
+		{
+			auto indexStart = std::chrono::high_resolution_clock::now();
+
+			auto& editorIDMap = g_editorIDIndexMap[a_formType];
+
+			const auto* formArray = GetFormArray(a_formType);
+			if (formArray)
+			{
+				editorIDMap.reserve(formArray->size());
+
+				for (auto* form : *formArray)
+				{
+					if (!form)
+					{
+						continue;
+					}
+
+					const auto editorID = GetEditorID(form);
+					if (editorID.empty())
+					{
+						continue;
+					}
+
+					editorIDMap.emplace(std::string(editorID), form);
+				}
+			}
+
+			auto indexEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> indexDuration = indexEnd - indexStart;
+
+			logger::info("Built EditorID index for form type {} ({} entries) in {} seconds", RE::stl::to_underlying(a_formType), editorIDMap.size(), indexDuration.count());
+
+			return editorIDMap;
+		}
+
+		// Whether a_pattern refers back to one of its own groups, either as \1..\9 or as \k<name>.
+		bool HasBackreference(std::string_view a_pattern)
+		{
+			for (std::size_t charIndex = 0; charIndex + 1 < a_pattern.size(); ++charIndex)
+			{
+				if (a_pattern[charIndex] != '\\')
+				{
+					continue;
+				}
+
+				const auto nextChar = a_pattern[++charIndex];
+				if ((nextChar >= '1' && nextChar <= '9') || nextChar == 'k')
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		const PatternMatchMap& MatchEditorIDPatterns(RE::ENUM_FORM_ID a_formType)
+		{
+			auto matchStart = std::chrono::high_resolution_clock::now();
+
+			auto& patternMatchMap = g_patternMatchMap[a_formType];
+
+			// Joining patterns into one alternation renumbers their capture groups, which would break backreferences.
+			// Only patterns without them are combined; the others are matched on their own against every form.
+			std::string combinedPattern;
+			std::vector<std::size_t> combinedIndices;
+			std::vector<std::size_t> separateIndices;
+			std::vector<srell::regex> regexVec;
+			regexVec.reserve(g_editorIDPatterns.size());
+
+			for (std::size_t patternIndex = 0; patternIndex < g_editorIDPatterns.size(); ++patternIndex)
+			{
+				const auto& pattern = g_editorIDPatterns[patternIndex];
+
+				regexVec.emplace_back(pattern, srell::regex_constants::icase);
+				patternMatchMap[pattern];
+
+				if (HasBackreference(pattern))
+				{
+					separateIndices.emplace_back(patternIndex);
+					continue;
+				}
+
+				if (!combinedPattern.empty())
+				{
+					combinedPattern += '|';
+				}
+				combinedPattern += "(?:" + pattern + ")";
+
+				combinedIndices.emplace_back(patternIndex);
+			}
+
+			const srell::regex combinedRegex(combinedPattern, srell::regex_constants::icase);
+
+			const auto* formArray = GetFormArray(a_formType);
+			if (formArray)
+			{
+				for (auto* form : *formArray)
+				{
+					if (!form)
+					{
+						continue;
+					}
+
+					const auto editorID = GetEditorID(form);
+					if (editorID.empty())
+					{
+						continue;
+					}
+
+					// Most forms are rejected by the combined matcher. Only the hits are attributed to the individual patterns.
+					if (!combinedIndices.empty() && srell::regex_match(editorID.begin(), editorID.end(), combinedRegex))
+					{
+						for (const auto patternIndex : combinedIndices)
+						{
+							if (combinedIndices.size() == 1 || srell::regex_match(editorID.begin(), editorID.end(), regexVec[patternIndex]))
+							{
+								patternMatchMap[g_editorIDPatterns[patternIndex]].emplace_back(form);
+							}
+						}
+					}
+
+					for (const auto patternIndex : separateIndices)
+					{
+						if (srell::regex_match(editorID.begin(), editorID.end(), regexVec[patternIndex]))
+						{
+							patternMatchMap[g_editorIDPatterns[patternIndex]].emplace_back(form);
+						}
+					}
+				}
+			}
+
+			auto matchEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> matchDuration = matchEnd - matchStart;
+
+			logger::info("Matched {} EditorID patterns for form type {} in {} seconds", g_editorIDPatterns.size(), RE::stl::to_underlying(a_formType), matchDuration.count());
+
+			return patternMatchMap;
+		}
+
+		struct ResolvedPredicate
+		{
+			Predicate::PredicateType Type;
+			RE::BGSKeyword* Keyword = nullptr;
+			const Utils::PluginInfo* Plugin = nullptr;
+			FieldGetter Getter = nullptr;
+			float Min = 0.0f;
+			float Max = 0.0f;
+		};
+
+		bool IsFormFromPlugin(const Utils::PluginInfo& a_pluginInfo, std::uint32_t a_formID)
+		{
+			if (!a_pluginInfo.IsActive)
+			{
+				return false;
+			}
+
+			if ((a_formID >> 24) != a_pluginInfo.CompileIndex)
+			{
+				return false;
+			}
+
+			return !a_pluginInfo.IsLight || ((a_formID >> 12) & 0xFFFu) == a_pluginInfo.SmallFileCompileIndex;
+		}
+
+		bool EvaluatePredicate(RE::TESForm* a_form, const ResolvedPredicate& a_predicate)
+		{
+			switch (a_predicate.Type)
+			{
+			case Predicate::PredicateType::kKeyword:
+				{
+					auto* keywordForm = a_form->As<RE::BGSKeywordForm>();
+					return a_predicate.Keyword && keywordForm && keywordForm->HasKeyword(a_predicate.Keyword);
+				}
+
+			case Predicate::PredicateType::kPlugin:
+				return a_predicate.Plugin && IsFormFromPlugin(*a_predicate.Plugin, a_form->GetFormID());
+
+			case Predicate::PredicateType::kRange:
+				{
+					const auto value = a_predicate.Getter(a_form);
+					return value >= a_predicate.Min && value <= a_predicate.Max;
+				}
+
+			default:
+				return false;
+			}
+		}
+
+		std::vector<ResolvedPredicate> ResolvePredicates(std::string_view a_key, const std::vector<Predicate>& a_predicates)
+		{
+			std::vector<ResolvedPredicate> resolvedPredicates;
+			resolvedPredicates.reserve(a_predicates.size());
+
+			for (const auto& predicate : a_predicates)
+			{
+				ResolvedPredicate resolved{ predicate.Type };
+
+				if (predicate.Type == Predicate::PredicateType::kKeyword)
+				{
+					auto* form = Utils::GetFormFromString(predicate.Value);
+					resolved.Keyword = form ? form->As<RE::BGSKeyword>() : nullptr;
+					if (!resolved.Keyword)
+					{
+						logger::warn("Invalid Keyword '{}' in filter '{}'.", predicate.Value, a_key);
+					}
+				}
+				else if (predicate.Type == Predicate::PredicateType::kPlugin)
+				{
+					const auto* pluginInfo = Utils::GetPluginInfo(predicate.Value);
+					resolved.Plugin = pluginInfo && pluginInfo->IsActive ? pluginInfo : nullptr;
+					if (!resolved.Plugin)
+					{
+						logger::warn("Invalid Plugin '{}' in filter '{}'.", predicate.Value, a_key);
+					}
+				}
+				else if (predicate.Type == Predicate::PredicateType::kRange)
+				{
+					resolved.Getter = predicate.Getter;
+					resolved.Min = predicate.Min;
+					resolved.Max = predicate.Max;
+				}
+
+				resolvedPredicates.emplace_back(resolved);
+			}
+
+			return resolvedPredicates;
+		}
+
+		const PatternMatchMap& ScanPredicateFilters(RE::ENUM_FORM_ID a_formType)
+		{
+			auto scanStart = std::chrono::high_resolution_clock::now();
+
+			auto& predicateMatchMap = g_predicateMatchMap[a_formType];
+
+			std::vector<std::pair<std::vector<RE::TESForm*>*, std::vector<ResolvedPredicate>>> filters;
+			for (const auto& [key, predicates] : g_predicateFilterMap[a_formType])
+			{
+				filters.emplace_back(std::addressof(predicateMatchMap[key]), ResolvePredicates(key, predicates));
+			}
+
+			// One pass over the form array answers every predicate filter registered for this form type.
+			const auto* formArray = GetFormArray(a_formType);
+			if (formArray)
+			{
+				for (auto* form : *formArray)
+				{
+					if (!form)
+					{
+						continue;
+					}
+
+					for (auto& [matches, predicates] : filters)
+					{
+						if (std::all_of(predicates.begin(), predicates.end(), [form](const ResolvedPredicate& a_predicate) { return EvaluatePredicate(form, a_predicate); }))
+						{
+							matches->emplace_back(form);
+						}
+					}
+				}
+			}
+
+			auto scanEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> scanDuration = scanEnd - scanStart;
+
+			logger::info("Scanned form type {} for {} predicate filters in {} seconds", RE::stl::to_underlying(a_formType), filters.size(), scanDuration.count());
+
+			return predicateMatchMap;
+		}
+
+		RE::BGSKeyword* GetKeyword(std::string_view a_formStr)
+		{
+			auto* form = Utils::GetFormFromString(a_formStr);
+			return form ? form->As<RE::BGSKeyword>() : nullptr;
+		}
+
+		KeywordPostingMap BuildKeywordIndex(RE::ENUM_FORM_ID a_formType, const RE::BSTArray<RE::TESForm*>& a_formArray)
+		{
+			auto indexStart = std::chrono::high_resolution_clock::now();
+
+			// Only keywords referenced by some FilterByKeyword statement get a posting list.
+			KeywordPostingMap postingMap;
+			for (const auto& [key, postfixTokens] : g_keywordFilterMap)
+			{
+				for (const auto& token : postfixTokens)
+				{
+					if (token.Type != KeywordToken::TokenType::kKeyword)
+					{
+						continue;
+					}
+
+					auto* keyword = GetKeyword(token.Form);
+					if (!keyword)
+					{
+						logger::warn("Invalid Keyword '{}' in filter '{}'.", token.Form, key);
+						continue;
+					}
+
+					postingMap[keyword];
+				}
+			}
+
+			std::size_t postingCount = 0;
+
+			for (std::uint32_t formIndex = 0; formIndex < a_formArray.size(); ++formIndex)
+			{
+				auto* form = a_formArray[formIndex];
+				if (!form)
+				{
+					continue;
+				}
+
+				auto* keywordForm = form->As<RE::BGSKeywordForm>();
+				if (!keywordForm || !keywordForm->keywords)
+				{
+					continue;
+				}
+
+				for (std::uint32_t keywordIndex = 0; keywordIndex < keywordForm->numKeywords; ++keywordIndex)
+				{
+					const auto it = postingMap.find(keywordForm->keywords[keywordIndex]);
+					if (it == postingMap.end())
+					{
+						continue;
+					}
+
+					// A form can list the same keyword twice; keep the posting list strictly ascending.
+					if (it->second.empty() || it->second.back() != formIndex)
+					{
+						it->second.emplace_back(formIndex);
+						postingCount++;
+					}
+				}
+			}
+
+			auto indexEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> indexDuration = indexEnd - indexStart;
+
+			logger::info("Built keyword index for form type {} ({} keywords, {} postings) in {} seconds", RE::stl::to_underlying(a_formType), postingMap.size(), postingCount, indexDuration.count());
+
+			return postingMap;
+		}
+
+		struct PostingSet
+		{
+			std::vector<std::uint32_t> Indices;
+			bool Negated = false;
+		};
+
+		PostingSet CombinePostings(const PostingSet& a_lhs, const PostingSet& a_rhs, bool a_isAnd)
+		{
+			PostingSet result;
+
+			auto intersect = [&result](const std::vector<std::uint32_t>& a_first, const std::vector<std::uint32_t>& a_second) {
+				std::set_intersection(a_first.begin(), a_first.end(), a_second.begin(), a_second.end(), std::back_inserter(result.Indices));
+			};
+			auto unite = [&result](const std::vector<std::uint32_t>& a_first, const std::vector<std::uint32_t>& a_second) {
+				std::set_union(a_first.begin(), a_first.end(), a_second.begin(), a_second.end(), std::back_inserter(result.Indices));
+			};
+			auto subtract = [&result](const std::vector<std::uint32_t>& a_first, const std::vector<std::uint32_t>& a_second) {
+				std::set_difference(a_first.begin(), a_first.end(), a_second.begin(), a_second.end(), std::back_inserter(result.Indices));
+			};
+
+			// Negated sets are kept symbolic, so "A && !B" is a difference instead of a complement over every form.
+			if (a_isAnd)
+			{
+				if (!a_lhs.Negated && !a_rhs.Negated)
+				{
+					intersect(a_lhs.Indices, a_rhs.Indices);
+				}
+				else if (!a_lhs.Negated)
+				{
+					subtract(a_lhs.Indices, a_rhs.Indices);
+				}
+				else if (!a_rhs.Negated)
+				{
+					subtract(a_rhs.Indices, a_lhs.Indices);
+				}
+				else
+				{
+					unite(a_lhs.Indices, a_rhs.Indices);
+					result.Negated = true;
+				}
+			}
+			else
+			{
+				if (!a_lhs.Negated && !a_rhs.Negated)
+				{
+					unite(a_lhs.Indices, a_rhs.Indices);
+				}
+				else if (!a_lhs.Negated)
+				{
+					subtract(a_rhs.Indices, a_lhs.Indices);
+					result.Negated = true;
+				}
+				else if (!a_rhs.Negated)
+				{
+					subtract(a_lhs.Indices, a_rhs.Indices);
+					result.Negated = true;
+				}
+				else
+				{
+					intersect(a_lhs.Indices, a_rhs.Indices);
+					result.Negated = true;
+				}
+			}
+
+			return result;
+		}
+
+		std::optional<std::vector<std::uint32_t>> EvaluateKeywordFilter(const std::vector<KeywordToken>& a_postfixTokens, const KeywordPostingMap& a_postingMap, std::uint32_t a_formCount)
+		{
+			std::vector<PostingSet> evalStack;
+
+			for (const auto& token : a_postfixTokens)
+			{
+				switch (token.Type)
+				{
+				case KeywordToken::TokenType::kKeyword:
+					{
+						PostingSet postingSet;
+
+						auto* keyword = GetKeyword(token.Form);
+						const auto it = keyword ? a_postingMap.find(keyword) : a_postingMap.end();
+						if (it != a_postingMap.end())
+						{
+							postingSet.Indices = it->second;
+						}
+
+						evalStack.emplace_back(std::move(postingSet));
+					}
+					break;
+
+				case KeywordToken::TokenType::kNot:
+					if (evalStack.empty())
+					{
+						return std::nullopt;
+					}
+					evalStack.back().Negated = !evalStack.back().Negated;
+					break;
+
+				case KeywordToken::TokenType::kAnd:
+				case KeywordToken::TokenType::kOr:
+					{
+						if (evalStack.size() < 2)
+						{
+							return std::nullopt;
+						}
+
+						auto rhs = std::move(evalStack.back());
+						evalStack.pop_back();
+						auto lhs = std::move(evalStack.back());
+						evalStack.pop_back();
+
+						evalStack.emplace_back(CombinePostings(lhs, rhs, token.Type == KeywordToken::TokenType::kAnd));
+					}
+					break;
+				}
+			}
+
+			if (evalStack.size() != 1)
+			{
+				return std::nullopt;
+			}
+
+			auto& result = evalStack.back();
+			if (!result.Negated)
+			{
+				return std::move(result.Indices);
+			}
+
+			std::vector<std::uint32_t> complement;
+			complement.reserve(a_formCount - result.Indices.size());
+
+			auto excludedIt = result.Indices.begin();
+			for (std::uint32_t formIndex = 0; formIndex < a_formCount; ++formIndex)
+			{
+				if (excludedIt != result.Indices.end() && *excludedIt == formIndex)
+				{
+					++excludedIt;
+					continue;
+				}
+				complement.emplace_back(formIndex);
+			}
+
+			return complement;
+		}
+
+		const PatternMatchMap& MatchKeywordFilters(RE::ENUM_FORM_ID a_formType)
+		{
+			auto& keywordMatchMap = g_keywordMatchMap[a_formType];
+
+			const auto* formArray = GetFormArray(a_formType);
+			if (!formArray)
+			{
+				return keywordMatchMap;
+			}
+
+			const auto postingMap = BuildKeywordIndex(a_formType, *formArray);
+			const auto formCount = static_cast<std::uint32_t>(formArray->size());
+
+			for (const auto& [key, postfixTokens] : g_keywordFilterMap)
+			{
+				auto& matches = keywordMatchMap[key];
+
+				const auto indicesOpt = EvaluateKeywordFilter(postfixTokens, postingMap, formCount);
+				if (!indicesOpt.has_value())
+				{
+					logger::warn("Failed to evaluate keyword filter '{}'.", key);
+					continue;
+				}
+
+				matches.reserve(indicesOpt->size());
+				for (const auto formIndex : indicesOpt.value())
+				{
+					auto* form = (*formArray)[formIndex];
+					if (form)
+					{
+						matches.emplace_back(form);
+					}
+				}
+			}
+
+			return keywordMatchMap;
+		}
+
+		const std::vector<RE::TESForm*>& GetSortedFormArray(RE::ENUM_FORM_ID a_formType)
+		{
+			const auto it = g_sortedFormArrayMap.find(a_formType);
+			if (it != g_sortedFormArrayMap.end())
+			{
+				return it->second;
+			}
+
+			auto& sortedForms = g_sortedFormArrayMap[a_formType];
+
+			const auto* formArray = GetFormArray(a_formType);
+			if (formArray)
+			{
+				sortedForms.reserve(formArray->size());
+				for (auto* form : *formArray)
+				{
+					if (form)
+					{
+						sortedForms.emplace_back(form);
+					}
+				}
+
+				std::sort(sortedForms.begin(), sortedForms.end(), [](const RE::TESForm* a_lhs, const RE::TESForm* a_rhs) {
+					return a_lhs->GetFormID() < a_rhs->GetFormID();
+				});
+			}
+
+			return sortedForms;
+		}
+
+		void MatchDefiningPlugin(RE::ENUM_FORM_ID a_formType, const Utils::PluginInfo& a_pluginInfo, std::vector<RE::TESForm*>& a_matches)
+		{
+			if (!a_pluginInfo.IsActive)
+			{
+				return;
+			}
+
+			std::uint32_t firstFormID = static_cast<std::uint32_t>(a_pluginInfo.CompileIndex) << 24;
+			std::uint32_t lastFormID = firstFormID | 0xFFFFFFu;
+
+			if (a_pluginInfo.IsLight)
+			{
+				firstFormID |= static_cast<std::uint32_t>(a_pluginInfo.SmallFileCompileIndex) << 12;
+				lastFormID = firstFormID | 0xFFFu;
+			}
+
+			const auto& sortedForms = GetSortedFormArray(a_formType);
+
+			const auto first = std::lower_bound(sortedForms.begin(), sortedForms.end(), firstFormID, [](const RE::TESForm* a_form, std::uint32_t a_formID) {
+				return a_form->GetFormID() < a_formID;
+			});
+			const auto last = std::upper_bound(first, sortedForms.end(), lastFormID, [](std::uint32_t a_formID, const RE::TESForm* a_form) {
+				return a_formID < a_form->GetFormID();
+			});
+
+			a_matches.assign(first, last);
+		}
+
+		const PatternMatchMap& MatchPluginFilters(RE::ENUM_FORM_ID a_formType)
+		{
+			auto matchStart = std::chrono::high_resolution_clock::now();
+
+			auto& pluginMatchMap = g_pluginMatchMap[a_formType];
+
+			// Plugins whose overrides are collected in a single pass over the form array.
+			std::vector<std::pair<RE::TESFile*, std::vector<RE::TESForm*>*>> overridingPlugins;
+
+			for (auto& [key, pluginFilter] : g_pluginFilterMap)
+			{
+				auto& matches = pluginMatchMap[key];
+
+				const auto* pluginInfo = Utils::GetPluginInfo(pluginFilter.PluginName);
+				if (!pluginInfo || !pluginInfo->IsActive)
+				{
+					// Plugin filters are shared by every form type, so the warning is logged only once.
+					if (!pluginFilter.Reported)
+					{
+						logger::warn("Invalid Plugin '{}' in filter '{}'.", pluginFilter.PluginName, key);
+						pluginFilter.Reported = true;
+					}
+
+					continue;
+				}
+
+				if (pluginFilter.Overridden)
+				{
+					overridingPlugins.emplace_back(pluginInfo->File, std::addressof(matches));
+				}
+				else
+				{
+					MatchDefiningPlugin(a_formType, *pluginInfo, matches);
+				}
+			}
+
+			if (!overridingPlugins.empty())
+			{
+				for (auto* form : GetSortedFormArray(a_formType))
+				{
+					if (!form->sourceFiles.array)
+					{
+						continue;
+					}
+
+					for (auto* file : *form->sourceFiles.array)
+					{
+						for (auto& [pluginFile, matches] : overridingPlugins)
+						{
+							if (file == pluginFile && (matches->empty() || matches->back() != form))
+							{
+								matches->emplace_back(form);
+							}
+						}
+					}
+				}
+			}
+
+			auto matchEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> matchDuration = matchEnd - matchStart;
+
+			logger::info("Matched {} plugin filters for form type {} in {} seconds", g_pluginFilterMap.size(), RE::stl::to_underlying(a_formType), matchDuration.count());
+
+			return pluginMatchMap;
+		}
+
+		// Returns the cache entry for a_formType, building it under the exclusive lock on first use.
+		template <typename CacheT, typename BuildF>
+		const typename CacheT::mapped_type& GetOrBuild(const CacheT& a_cache, RE::ENUM_FORM_ID a_formType, BuildF a_buildFunc)
+		{
+			{
+				std::shared_lock lock(g_cacheMutex);
+
+				const auto it = a_cache.find(a_formType);
+				if (it != a_cache.end())
+				{
+					return it->second;
+				}
+			}
+
+			std::scoped_lock lock(g_cacheMutex);
+
+			const auto it = a_cache.find(a_formType);
+			return it != a_cache.end() ? it->second : a_buildFunc(a_formType);
+		}
+	}  // namespace
+
+	bool AddEditorIDPattern(std::string_view a_pattern)
+	{
+		try
+		{
+			[[maybe_unused]] const srell::regex regex(a_pattern.data(), a_pattern.size(), srell::regex_constants::icase);
+		} catch (const srell::regex_error&)
+		{
+			return false;
+		}
+
+		const std::string pattern(a_pattern);
+		if (std::find(g_editorIDPatterns.begin(), g_editorIDPatterns.end(), pattern) == g_editorIDPatterns.end())
+		{
+			g_editorIDPatterns.emplace_back(pattern);
+		}
+
+		return true;
+	}
+
+	RE::TESForm* GetFormByEditorID(RE::ENUM_FORM_ID a_formType, std::string_view a_editorID)
+	{
+		const auto& editorIDMap = GetOrBuild(g_editorIDIndexMap, a_formType, BuildEditorIDIndex);
+
+		const auto it = editorIDMap.find(a_editorID);
+		return it != editorIDMap.end() ? it->second : nullptr;
+	}
+
+	const std::vector<RE::TESForm*>& GetFormsByEditorIDPattern(RE::ENUM_FORM_ID a_formType, std::string_view a_pattern)
+	{
+		static const std::vector<RE::TESForm*> kEmpty;
+
+		const auto& patternMatchMap = GetOrBuild(g_patternMatchMap, a_formType, MatchEditorIDPatterns);
+
+		const auto it = patternMatchMap.find(std::string(a_pattern));
+		return it != patternMatchMap.end() ? it->second : kEmpty;
+	}
+
+	void AddPredicateFilter(const PredicateContext& a_context, std::string_view a_key, const std::vector<Predicate>& a_predicates)
+	{
+		for (const auto formType : a_context.FormTypes)
+		{
+			g_predicateFilterMap[formType].emplace(std::string(a_key), a_predicates);
+		}
+	}
+
+	const std::vector<RE::TESForm*>& GetFormsByPredicates(RE::ENUM_FORM_ID a_formType, std::string_view a_key)
+	{
+		static const std::vector<RE::TESForm*> kEmpty;
+
+		const auto& predicateMatchMap = GetOrBuild(g_predicateMatchMap, a_formType, ScanPredicateFilters);
+
+		const auto it = predicateMatchMap.find(std::string(a_key));
+		return it != predicateMatchMap.end() ? it->second : kEmpty;
+	}
+
+	void AddKeywordFilter(std::string_view a_key, const std::vector<KeywordToken>& a_postfixTokens)
+	{
+		g_keywordFilterMap.emplace(std::string(a_key), a_postfixTokens);
+	}
+
+	const std::vector<RE::TESForm*>& GetFormsByKeywords(RE::ENUM_FORM_ID a_formType, std::string_view a_key)
+	{
+		static const std::vector<RE::TESForm*> kEmpty;
+
+		const auto& keywordMatchMap = GetOrBuild(g_keywordMatchMap, a_formType, MatchKeywordFilters);
+
+		const auto it = keywordMatchMap.find(std::string(a_key));
+		return it != keywordMatchMap.end() ? it->second : kEmpty;
+	}
+
+	void AddPluginFilter(std::string_view a_key, std::string_view a_pluginName, bool a_overridden)
+	{
+		g_pluginFilterMap.emplace(std::string(a_key), PluginFilter{ std::string(a_pluginName), a_overridden });
+	}
+
+	const std::vector<RE::TESForm*>& GetFormsByPlugin(RE::ENUM_FORM_ID a_formType, std::string_view a_key)
+	{
+		static const std::vector<RE::TESForm*> kEmpty;
+
+		const auto& pluginMatchMap = GetOrBuild(g_pluginMatchMap, a_formType, MatchPluginFilters);
+
+		const auto it = pluginMatchMap.find(std::string(a_key));
+		return it != pluginMatchMap.end() ? it->second : kEmpty;
+	}
+
+	void Clear()
+	{
+		g_editorIDIndexMap.clear();
+		g_patternMatchMap.clear();
+		g_predicateMatchMap.clear();
+		g_keywordMatchMap.clear();
+		g_pluginMatchMap.clear();
+		g_sortedFormArrayMap.clear();
+	}
+}  // namespace FormFilters
@@ -1,9 +1,11 @@
 #include "ImageSpaceAdapters.h"
 
 #include <any>
+#include <array>
 #include <regex>
 
 #include "ConfigUtils.h"
+#include "PatchTable.h"
 
 namespace RE
 {
@@ -154,7 +156,9 @@ namespace ImageSpaceAdapters
 
 		enum class FilterType
 		{
-			kFormID
+			kFormID,
+			kEditorID,
+			kEditorIDPattern
 		};
 
 		std::string_view FilterTypeToString(FilterType a_value)
@@ -163,6 +167,10 @@ namespace ImageSpaceAdapters
 			{
 			case FilterType::kFormID:
 				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
 			default:
 				return std::string_view{};
 			}
@@ -313,7 +321,11 @@ namespace ImageSpaceAdapters
 		enum class OperationType
 		{
 			kClear,
-			kAdd
+			kAdd,
+			kScale,
+			kOffset,
+			kTimeScale,
+			kClamp
 		};
 
 		std::string_view OperationTypeToString(OperationType a_value)
@@ -324,6 +336,14 @@ namespace ImageSpaceAdapters
 				return "Clear";
 			case OperationType::kAdd:
 				return "Add";
+			case OperationType::kScale:
+				return "Scale";
+			case OperationType::kOffset:
+				return "Offset";
+			case OperationType::kTimeScale:
+				return "TimeScale";
+			case OperationType::kClamp:
+				return "Clamp";
 			default:
 				return std::string_view{};
 			}
@@ -348,6 +368,12 @@ namespace ImageSpaceAdapters
 					float Alpha;
 				};
 
+				struct RangeData
+				{
+					float Min;
+					float Max;
+				};
+
 				OperationType Type;
 				std::optional<std::any> Data;
 			};
@@ -359,79 +385,195 @@ namespace ImageSpaceAdapters
 			std::vector<Operation> Operations;
 		};
 
-		struct PatchData
+		template <typename InterpolatorT>
+		struct InterpolatorTraits;
+
+		template <>
+		struct InterpolatorTraits<RE::NiFloatInterpolator>
 		{
-			struct FloatInterpolatorData
+			using data_type = RE::NiFloatData;
+			using key_type = RE::NiFloatData::Data;
+
+			static constexpr std::string_view kInterpolatorName = "NiFloatInterpolator";
+			static constexpr std::string_view kDataName = "NiFloatData";
+
+			static RE::NiPointer<RE::NiFloatData>& GetData(RE::NiFloatInterpolator* a_interpolator)
 			{
-				struct FloatData
+				return a_interpolator->floatData;
+			}
+
+			static key_type ToKey(const std::any& a_data)
+			{
+				const auto data = std::any_cast<ConfigData::Operation::FloatData>(a_data);
+				return key_type{ data.Time, data.Value };
+			}
+
+			template <typename FnT>
+			static void TransformValues(key_type* a_keys, std::uint32_t a_numKeys, FnT a_fn)
+			{
+				for (std::uint32_t keyIndex = 0; keyIndex < a_numKeys; ++keyIndex)
 				{
-					float Time;
-					float Value;
-				};
+					a_keys[keyIndex].value = a_fn(a_keys[keyIndex].value);
+				}
+			}
+		};
 
-				bool Clear;
-				std::vector<FloatData> AddVec;
-			};
+		template <>
+		struct InterpolatorTraits<RE::NiColorInterpolator>
+		{
+			using data_type = RE::NiColorData;
+			using key_type = RE::NiColorData::Data;
+
+			static constexpr std::string_view kInterpolatorName = "NiColorInterpolator";
+			static constexpr std::string_view kDataName = "NiColorData";
 
-			struct ColorInterpolatorData
+			static RE::NiPointer<RE::NiColorData>& GetData(RE::NiColorInterpolator* a_interpolator)
 			{
-				struct ColorData
+				return a_interpolator->colorData;
+			}
+
+			static key_type ToKey(const std::any& a_data)
+			{
+				const auto data = std::any_cast<ConfigData::Operation::ColorData>(a_data);
+				return key_type{ data.Time, { data.Red, data.Green, data.Blue, data.Alpha } };
+			}
+
+			// Color curves are transformed per channel, alpha included.
+			template <typename FnT>
+			static void TransformValues(key_type* a_keys, std::uint32_t a_numKeys, FnT a_fn)
+			{
+				for (std::uint32_t keyIndex = 0; keyIndex < a_numKeys; ++keyIndex)
 				{
-					float Time;
-					RE::NiColorA Color;
-				};
+					auto& color = a_keys[keyIndex].color;
+					color.r = a_fn(color.r);
+					color.g = a_fn(color.g);
+					color.b = a_fn(color.b);
+					color.a = a_fn(color.a);
+				}
+			}
+		};
+
+		template <typename InterpolatorT>
+		struct InterpolatorSlot
+		{
+			std::uint32_t& KeySize;
+			RE::NiPointer<InterpolatorT>& Interpolator;
+		};
+
+		template <typename InterpolatorT>
+		struct InterpolatorDescriptor
+		{
+			ElementType Element;
+			InterpolatorSlot<InterpolatorT> (*GetSlot)(RE::TESImageSpaceModifier*);
+		};
+
+		template <std::size_t Index, std::size_t Mode>
+		InterpolatorSlot<RE::NiFloatInterpolator> GetTableSlot(RE::TESImageSpaceModifier* a_imageSpaceAdapter)
+		{
+			return { a_imageSpaceAdapter->data.keySize[Index][Mode], a_imageSpaceAdapter->interpolator[Index][Mode] };
+		}
+
+		// Maps every interpolated element to the keySize and interpolator it edits. Prepare and Patch are
+		// driven by these tables, so supporting another curve only needs a new ElementType and a row here.
+		constexpr std::array<InterpolatorDescriptor<RE::NiFloatInterpolator>, 35> kFloatInterpolators{ {
+			{ ElementType::kBlurRadius, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.blurKeySize, a_isa->blurInterpolator }; } },
+			{ ElementType::kDoubleVisionStrength, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.doubleKeySize, a_isa->doubleInterpolator }; } },
+			{ ElementType::kRadialBlurStrength, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.radialBlurStrengthKeySize, a_isa->radialBlurStrengthInterpolator }; } },
+			{ ElementType::kRadialBlurRampUp, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.radialBlurRampupKeySize, a_isa->radialBlurRampupInterpolator }; } },
+			{ ElementType::kRadialBlurRampDown, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.radialBlurRampDownKeySize, a_isa->radialBlurRampDownInterpolator }; } },
+			{ ElementType::kRadialBlurStart, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.radialBlurStartKeySize, a_isa->radialBlurStartInterpolator }; } },
+			{ ElementType::kRadialBlurDownStart, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.radialBlurDownStartKeySize, a_isa->radialBlurDownStartInterpolator }; } },
+			{ ElementType::kDepthOfFieldStrength, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.depthOfFieldStrengthKeySize, a_isa->depthOfFieldStrengthInterpolator }; } },
+			{ ElementType::kDepthOfFieldDistance, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.depthOfFieldDistanceKeySize, a_isa->depthOfFieldDistanceInterpolator }; } },
+			{ ElementType::kDepthOfFieldRange, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.depthOfFieldRangeKeySize, a_isa->depthOfFieldRangeInterpolator }; } },
+			{ ElementType::kDepthOfFieldVignetteRadius, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.depthOfFieldVignetteRadiusKeySize, a_isa->depthOfFieldVignetteRadiusInterpolator }; } },
+			{ ElementType::kDepthOfFieldVignetteStrength, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.depthOfFieldVignetteStrengthKeySize, a_isa->depthOfFieldVignetteStrengthInterpolator }; } },
+			{ ElementType::kMotionBlurStrength, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiFloatInterpolator> { return { a_isa->data.motionBlurStrengthKeySize, a_isa->motionBlurStrengthInterpolator }; } },
+			{ ElementType::kHDREyeAdaptSpeedMult, GetTableSlot<0, 0> },
+			{ ElementType::kHDREyeAdaptSpeedAdd, GetTableSlot<0, 1> },
+			{ ElementType::kHDRBloomBlurRadiusMult, GetTableSlot<1, 0> },
+			{ ElementType::kHDRBloomBlurRadiusAdd, GetTableSlot<1, 1> },
+			{ ElementType::kHDRBloomThresholdMult, GetTableSlot<2, 0> },
+			{ ElementType::kHDRBloomThresholdAdd, GetTableSlot<2, 1> },
+			{ ElementType::kHDRBloomScaleMult, GetTableSlot<3, 0> },
+			{ ElementType::kHDRBloomScaleAdd, GetTableSlot<3, 1> },
+			{ ElementType::kHDRTargetLumMinMult, GetTableSlot<4, 0> },
+			{ ElementType::kHDRTargetLumMinAdd, GetTableSlot<4, 1> },
+			{ ElementType::kHDRTargetLumMaxMult, GetTableSlot<5, 0> },
+			{ ElementType::kHDRTargetLumMaxAdd, GetTableSlot<5, 1> },
+			{ ElementType::kHDRSunlightScaleMult, GetTableSlot<6, 0> },
+			{ ElementType::kHDRSunlightScaleAdd, GetTableSlot<6, 1> },
+			{ ElementType::kHDRSkyScaleMult, GetTableSlot<7, 0> },
+			{ ElementType::kHDRSkyScaleAdd, GetTableSlot<7, 1> },
+			{ ElementType::kCinematicSaturationMult, GetTableSlot<17, 0> },
+			{ ElementType::kCinematicSaturationAdd, GetTableSlot<17, 1> },
+			{ ElementType::kCinematicBrightnessMult, GetTableSlot<18, 0> },
+			{ ElementType::kCinematicBrightnessAdd, GetTableSlot<18, 1> },
+			{ ElementType::kCinematicContrastMult, GetTableSlot<19, 0> },
+			{ ElementType::kCinematicContrastAdd, GetTableSlot<19, 1> },
+		} };
+
+		constexpr std::array<InterpolatorDescriptor<RE::NiColorInterpolator>, 2> kColorInterpolators{ {
+			{ ElementType::kTintColor, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiColorInterpolator> { return { a_isa->data.tintColorKeySize, a_isa->tintColorInterpolator }; } },
+			{ ElementType::kFadeColor, [](RE::TESImageSpaceModifier* a_isa) -> InterpolatorSlot<RE::NiColorInterpolator> { return { a_isa->data.fadeColorKeySize, a_isa->fadeColorInterpolator }; } },
+		} };
+
+		template <typename InterpolatorT, std::size_t N>
+		constexpr std::optional<std::size_t> FindInterpolator(const std::array<InterpolatorDescriptor<InterpolatorT>, N>& a_descriptors, ElementType a_element)
+		{
+			for (std::size_t descriptorIndex = 0; descriptorIndex < N; ++descriptorIndex)
+			{
+				if (a_descriptors[descriptorIndex].Element == a_element)
+				{
+					return descriptorIndex;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		constexpr bool IsFloatInterpolator(ElementType a_element)
+		{
+			return FindInterpolator(kFloatInterpolators, a_element).has_value();
+		}
+
+		constexpr bool IsColorInterpolator(ElementType a_element)
+		{
+			return FindInterpolator(kColorInterpolators, a_element).has_value();
+		}
+
+		struct PatchData
+		{
+			struct TransformData
+			{
+				OperationType Type;
+				float First;
+				float Second;
+			};
 
+			template <typename InterpolatorT>
+			struct InterpolatorData
+			{
 				bool Clear;
-				std::vector<ColorData> AddVec;
+				std::vector<typename InterpolatorTraits<InterpolatorT>::key_type> AddVec;
+				std::vector<TransformData> TransformVec;
 			};
 
+			using FloatInterpolatorData = InterpolatorData<RE::NiFloatInterpolator>;
+			using ColorInterpolatorData = InterpolatorData<RE::NiColorInterpolator>;
+
 			std::optional<bool> Animatable;
 			std::optional<float> Duration;
-			std::optional<FloatInterpolatorData> BlurRadius;
-			std::optional<FloatInterpolatorData> DoubleVisionStrength;
-			std::optional<ColorInterpolatorData> TintColor;
-			std::optional<ColorInterpolatorData> FadeColor;
 			std::optional<bool> RadialBlurUseTarget;
 			std::optional<float> RadialBlurCenterX;
 			std::optional<float> RadialBlurCenterY;
-			std::optional<FloatInterpolatorData> RadialBlurStrength;
-			std::optional<FloatInterpolatorData> RadialBlurRampUp;
-			std::optional<FloatInterpolatorData> RadialBlurRampDown;
-			std::optional<FloatInterpolatorData> RadialBlurStart;
-			std::optional<FloatInterpolatorData> RadialBlurDownStart;
 			std::optional<bool> DepthOfFieldUseTarget;
-			std::optional<FloatInterpolatorData> DepthOfFieldStrength;
-			std::optional<FloatInterpolatorData> DepthOfFieldDistance;
-			std::optional<FloatInterpolatorData> DepthOfFieldRange;
-			std::optional<FloatInterpolatorData> DepthOfFieldVignetteRadius;
-			std::optional<FloatInterpolatorData> DepthOfFieldVignetteStrength;
-			std::optional<FloatInterpolatorData> MotionBlurStrength;
-			std::optional<FloatInterpolatorData> HDREyeAdaptSpeedMult;
-			std::optional<FloatInterpolatorData> HDREyeAdaptSpeedAdd;
-			std::optional<FloatInterpolatorData> HDRBloomBlurRadiusMult;
-			std::optional<FloatInterpolatorData> HDRBloomBlurRadiusAdd;
-			std::optional<FloatInterpolatorData> HDRBloomThresholdMult;
-			std::optional<FloatInterpolatorData> HDRBloomThresholdAdd;
-			std::optional<FloatInterpolatorData> HDRBloomScaleMult;
-			std::optional<FloatInterpolatorData> HDRBloomScaleAdd;
-			std::optional<FloatInterpolatorData> HDRTargetLumMinMult;
-			std::optional<FloatInterpolatorData> HDRTargetLumMinAdd;
-			std::optional<FloatInterpolatorData> HDRTargetLumMaxMult;
-			std::optional<FloatInterpolatorData> HDRTargetLumMaxAdd;
-			std::optional<FloatInterpolatorData> HDRSunlightScaleMult;
-			std::optional<FloatInterpolatorData> HDRSunlightScaleAdd;
-			std::optional<FloatInterpolatorData> HDRSkyScaleMult;
-			std::optional<FloatInterpolatorData> HDRSkyScaleAdd;
-			std::optional<FloatInterpolatorData> CinematicSaturationMult;
-			std::optional<FloatInterpolatorData> CinematicSaturationAdd;
-			std::optional<FloatInterpolatorData> CinematicBrightnessMult;
-			std::optional<FloatInterpolatorData> CinematicBrightnessAdd;
-			std::optional<FloatInterpolatorData> CinematicContrastMult;
-			std::optional<FloatInterpolatorData> CinematicContrastAdd;
+			std::array<std::optional<FloatInterpolatorData>, kFloatInterpolators.size()> FloatInterpolators;
+			std::array<std::optional<ColorInterpolatorData>, kColorInterpolators.size()> ColorInterpolators;
 		};
 
 		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::TESImageSpaceModifier*, PatchData> g_patchMap;
+		Utils::PatchTable<RE::TESImageSpaceModifier, PatchData> g_patchMap;
 
 		class ImageSpaceAdapterParser : public Parsers::Parser<ConfigData>
 		{
@@ -568,6 +710,22 @@ namespace ImageSpaceAdapters
 								opLog = fmt::format(".{}({}, {})", OperationTypeToString(a_configData.Operations[opIndex].Type), data.Time, data.Value);
 								break;
 							}
+
+						case OperationType::kScale:
+						case OperationType::kOffset:
+						case OperationType::kTimeScale:
+							{
+								const auto data = std::any_cast<float>(a_configData.Operations[opIndex].Data.value());
+								opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].Type), data);
+								break;
+							}
+
+						case OperationType::kClamp:
+							{
+								const auto data = std::any_cast<ConfigData::Operation::RangeData>(a_configData.Operations[opIndex].Data.value());
+								opLog = fmt::format(".{}({}, {})", OperationTypeToString(a_configData.Operations[opIndex].Type), data.Min, data.Max);
+								break;
+							}
 						}
 
 						if (opIndex == a_configData.Operations.size() - 1)
@@ -600,6 +758,22 @@ namespace ImageSpaceAdapters
 								opLog = fmt::format(".{}({}, {}, {}, {}, {})", OperationTypeToString(a_configData.Operations[opIndex].Type), data.Time, data.Red, data.Green, data.Blue, data.Alpha);
 								break;
 							}
+
+						case OperationType::kScale:
+						case OperationType::kOffset:
+						case OperationType::kTimeScale:
+							{
+								const auto data = std::any_cast<float>(a_configData.Operations[opIndex].Data.value());
+								opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].Type), data);
+								break;
+							}
+
+						case OperationType::kClamp:
+							{
+								const auto data = std::any_cast<ConfigData::Operation::RangeData>(a_configData.Operations[opIndex].Data.value());
+								opLog = fmt::format(".{}({}, {})", OperationTypeToString(a_configData.Operations[opIndex].Type), data.Min, data.Max);
+								break;
+							}
 						}
 
 						if (opIndex == a_configData.Operations.size() - 1)
@@ -620,6 +794,14 @@ namespace ImageSpaceAdapters
 				{
 					a_config.Filter = FilterType::kFormID;
 				}
+				else if (token == "FilterByEditorID")
+				{
+					a_config.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_config.Filter = FilterType::kEditorIDPattern;
+				}
 				else
 				{
 					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
@@ -633,7 +815,7 @@ namespace ImageSpaceAdapters
 					return false;
 				}
 
-				const auto filterFormOpt = ParseForm();
+				const auto filterFormOpt = ParseFilterForm(a_config.Filter);
 				if (!filterFormOpt.has_value())
 				{
 					return false;
@@ -893,6 +1075,22 @@ namespace ImageSpaceAdapters
 				{
 					newOp.Type = OperationType::kAdd;
 				}
+				else if (token == "Scale")
+				{
+					newOp.Type = OperationType::kScale;
+				}
+				else if (token == "Offset")
+				{
+					newOp.Type = OperationType::kOffset;
+				}
+				else if (token == "TimeScale")
+				{
+					newOp.Type = OperationType::kTimeScale;
+				}
+				else if (token == "Clamp")
+				{
+					newOp.Type = OperationType::kClamp;
+				}
 				else
 				{
 					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
@@ -900,49 +1098,13 @@ namespace ImageSpaceAdapters
 				}
 
 				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
-					switch (elem)
+					if (IsFloatInterpolator(elem) || IsColorInterpolator(elem))
 					{
-					case ElementType::kBlurRadius:
-					case ElementType::kDoubleVisionStrength:
-					case ElementType::kTintColor:
-					case ElementType::kFadeColor:
-					case ElementType::kRadialBlurStrength:
-					case ElementType::kRadialBlurRampUp:
-					case ElementType::kRadialBlurRampDown:
-					case ElementType::kRadialBlurStart:
-					case ElementType::kRadialBlurDownStart:
-					case ElementType::kDepthOfFieldStrength:
-					case ElementType::kDepthOfFieldDistance:
-					case ElementType::kDepthOfFieldRange:
-					case ElementType::kDepthOfFieldVignetteRadius:
-					case ElementType::kDepthOfFieldVignetteStrength:
-					case ElementType::kMotionBlurStrength:
-					case ElementType::kHDREyeAdaptSpeedMult:
-					case ElementType::kHDREyeAdaptSpeedAdd:
-					case ElementType::kHDRBloomBlurRadiusMult:
-					case ElementType::kHDRBloomBlurRadiusAdd:
-					case ElementType::kHDRBloomThresholdMult:
-					case ElementType::kHDRBloomThresholdAdd:
-					case ElementType::kHDRBloomScaleMult:
-					case ElementType::kHDRBloomScaleAdd:
-					case ElementType::kHDRTargetLumMinMult:
-					case ElementType::kHDRTargetLumMinAdd:
-					case ElementType::kHDRTargetLumMaxMult:
-					case ElementType::kHDRTargetLumMaxAdd:
-					case ElementType::kHDRSunlightScaleMult:
-					case ElementType::kHDRSunlightScaleAdd:
-					case ElementType::kHDRSkyScaleMult:
-					case ElementType::kHDRSkyScaleAdd:
-					case ElementType::kCinematicSaturationMult:
-					case ElementType::kCinematicSaturationAdd:
-					case ElementType::kCinematicBrightnessMult:
-					case ElementType::kCinematicBrightnessAdd:
-					case ElementType::kCinematicContrastMult:
-					case ElementType::kCinematicContrastAdd:
-						return op == OperationType::kClear || op == OperationType::kAdd;
-					default:
-						return false;
+						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kScale ||
+						       op == OperationType::kOffset || op == OperationType::kTimeScale || op == OperationType::kClamp;
 					}
+
+					return false;
 				}(a_config.Element, newOp.Type);
 
 				if (!isValidOperation)
@@ -958,43 +1120,58 @@ namespace ImageSpaceAdapters
 					return false;
 				}
 
-				if (a_config.Element == ElementType::kBlurRadius ||
-					a_config.Element == ElementType::kDoubleVisionStrength ||
-					a_config.Element == ElementType::kRadialBlurStrength ||
-					a_config.Element == ElementType::kRadialBlurRampUp ||
-					a_config.Element == ElementType::kRadialBlurRampDown ||
-					a_config.Element == ElementType::kRadialBlurStart ||
-					a_config.Element == ElementType::kRadialBlurDownStart ||
-					a_config.Element == ElementType::kDepthOfFieldStrength ||
-					a_config.Element == ElementType::kDepthOfFieldDistance ||
-					a_config.Element == ElementType::kDepthOfFieldRange ||
-					a_config.Element == ElementType::kDepthOfFieldVignetteRadius ||
-					a_config.Element == ElementType::kDepthOfFieldVignetteStrength ||
-					a_config.Element == ElementType::kMotionBlurStrength ||
-					a_config.Element == ElementType::kHDREyeAdaptSpeedMult ||
-					a_config.Element == ElementType::kHDREyeAdaptSpeedAdd ||
-					a_config.Element == ElementType::kHDRBloomBlurRadiusMult ||
-					a_config.Element == ElementType::kHDRBloomBlurRadiusAdd ||
-					a_config.Element == ElementType::kHDRBloomThresholdMult ||
-					a_config.Element == ElementType::kHDRBloomThresholdAdd ||
-					a_config.Element == ElementType::kHDRBloomScaleMult ||
-					a_config.Element == ElementType::kHDRBloomScaleAdd ||
-					a_config.Element == ElementType::kHDRTargetLumMinMult ||
-					a_config.Element == ElementType::kHDRTargetLumMinAdd ||
-					a_config.Element == ElementType::kHDRTargetLumMaxMult ||
-					a_config.Element == ElementType::kHDRTargetLumMaxAdd ||
-					a_config.Element == ElementType::kHDRSunlightScaleMult ||
-					a_config.Element == ElementType::kHDRSunlightScaleAdd ||
-					a_config.Element == ElementType::kHDRSkyScaleMult ||
-					a_config.Element == ElementType::kHDRSkyScaleAdd ||
-					a_config.Element == ElementType::kCinematicSaturationMult ||
-					a_config.Element == ElementType::kCinematicSaturationAdd ||
-					a_config.Element == ElementType::kCinematicBrightnessMult ||
-					a_config.Element == ElementType::kCinematicBrightnessAdd ||
-					a_config.Element == ElementType::kCinematicContrastMult ||
-					a_config.Element == ElementType::kCinematicContrastAdd)
-				{
-					if (newOp.Type != OperationType::kClear)
+				if (newOp.Type == OperationType::kScale || newOp.Type == OperationType::kOffset || newOp.Type == OperationType::kTimeScale)
+				{
+					const auto parsedNumberOpt = ParseNumber<float>();
+					if (!parsedNumberOpt.has_value())
+					{
+						return false;
+					}
+
+					if (newOp.Type == OperationType::kTimeScale && !(parsedNumberOpt.value() > 0.0f))
+					{
+						logger::warn("Line {}, Col {}: TimeScale factor must be greater than 0.", reader.GetLastLine(), reader.GetLastLineIndex());
+						return false;
+					}
+
+					newOp.Data = std::any(parsedNumberOpt.value());
+				}
+				else if (newOp.Type == OperationType::kClamp)
+				{
+					ConfigData::Operation::RangeData rangeData{};
+
+					auto parsedNumberOpt = ParseNumber<float>();
+					if (!parsedNumberOpt.has_value())
+					{
+						return false;
+					}
+					rangeData.Min = parsedNumberOpt.value();
+
+					token = reader.GetToken();
+					if (token != ",")
+					{
+						logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+						return false;
+					}
+
+					parsedNumberOpt = ParseNumber<float>();
+					if (!parsedNumberOpt.has_value())
+					{
+						return false;
+					}
+					rangeData.Max = parsedNumberOpt.value();
+
+					if (rangeData.Min > rangeData.Max)
+					{
+						logger::warn("Line {}, Col {}: Clamp minimum must not be greater than the maximum.", reader.GetLastLine(), reader.GetLastLineIndex());
+						return false;
+					}
+
+					newOp.Data = std::any(rangeData);
+				}
+				else if (IsFloatInterpolator(a_config.Element))
+				{
+					if (newOp.Type == OperationType::kAdd)
 					{
 						ConfigData::Operation::FloatData floatData{};
 
@@ -1022,9 +1199,9 @@ namespace ImageSpaceAdapters
 						newOp.Data = std::any(floatData);
 					}
 				}
-				else if (a_config.Element == ElementType::kTintColor || a_config.Element == ElementType::kFadeColor)
+				else if (IsColorInterpolator(a_config.Element))
 				{
-					if (newOp.Type != OperationType::kClear)
+					if (newOp.Type == OperationType::kAdd)
 					{
 						ConfigData::Operation::ColorData colorData{};
 
@@ -1108,1046 +1285,313 @@ namespace ImageSpaceAdapters
 			}
 		};
 
-		void Prepare(const ConfigData& a_configData)
+		// TimeScale factors are positive, so transformed keys keep their order.
+		template <typename InterpolatorT>
+		void TransformKeys(typename InterpolatorTraits<InterpolatorT>::key_type* a_keys, std::size_t a_numKeys, const PatchData::TransformData& a_transform)
 		{
-			if (a_configData.Filter == FilterType::kFormID)
+			using Traits = InterpolatorTraits<InterpolatorT>;
+
+			const auto numKeys = static_cast<std::uint32_t>(a_numKeys);
+
+			switch (a_transform.Type)
 			{
-				auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-				if (!filterForm)
-				{
-					logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-					return;
-				}
+			case OperationType::kScale:
+				Traits::TransformValues(a_keys, numKeys, [mult = a_transform.First](float a_value) { return a_value * mult; });
+				break;
+
+			case OperationType::kOffset:
+				Traits::TransformValues(a_keys, numKeys, [add = a_transform.First](float a_value) { return a_value + add; });
+				break;
+
+			case OperationType::kClamp:
+				Traits::TransformValues(a_keys, numKeys, [min = a_transform.First, max = a_transform.Second](float a_value) { return std::clamp(a_value, min, max); });
+				break;
 
-				auto* imageSpaceAdapter = filterForm->As<RE::TESImageSpaceModifier>();
-				if (!imageSpaceAdapter)
+			case OperationType::kTimeScale:
+				for (std::uint32_t keyIndex = 0; keyIndex < numKeys; ++keyIndex)
 				{
-					logger::warn("'{}' is not an ImageSpaceAdapter.", a_configData.FilterForm);
-					return;
+					a_keys[keyIndex].time *= a_transform.First;
 				}
+				break;
 
-				auto& patchData = g_patchMap[imageSpaceAdapter];
+			default:
+				break;
+			}
+		}
+
+		// Operations apply in config order: a transform changes the keys added before it, across statements too,
+		// but not the ones added after it. It is also recorded for the curve's own keys, which precede every Add.
+		template <typename InterpolatorT>
+		void PrepareInterpolatorData(const ConfigData& a_configData, std::optional<PatchData::InterpolatorData<InterpolatorT>>& a_interpolatorData)
+		{
+			if (!a_interpolatorData.has_value())
+			{
+				a_interpolatorData = PatchData::InterpolatorData<InterpolatorT>{};
+			}
 
-				if (a_configData.Element == ElementType::kAnimatable)
+			for (const auto& operation : a_configData.Operations)
+			{
+				if (operation.Type == OperationType::kClear)
 				{
-					patchData.Animatable = std::any_cast<bool>(a_configData.AssignValue.value());
+					a_interpolatorData->Clear = true;
 				}
-				else if (a_configData.Element == ElementType::kDuration)
+				else if (operation.Type == OperationType::kAdd)
 				{
-					patchData.Duration = std::any_cast<float>(a_configData.AssignValue.value());
+					a_interpolatorData->AddVec.emplace_back(InterpolatorTraits<InterpolatorT>::ToKey(operation.Data.value()));
 				}
-				else if (a_configData.Element == ElementType::kBlurRadius)
+				else
 				{
-					if (!patchData.BlurRadius.has_value())
-					{
-						patchData.BlurRadius = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
+					PatchData::TransformData transform{ operation.Type, 0.0f, 0.0f };
+					if (operation.Type == OperationType::kClamp)
 					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.BlurRadius->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.BlurRadius->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
+						const auto data = std::any_cast<ConfigData::Operation::RangeData>(operation.Data.value());
+						transform.First = data.Min;
+						transform.Second = data.Max;
 					}
-				}
-				else if (a_configData.Element == ElementType::kDoubleVisionStrength)
-				{
-					if (!patchData.DoubleVisionStrength.has_value())
+					else
 					{
-						patchData.DoubleVisionStrength = PatchData::FloatInterpolatorData{};
+						transform.First = std::any_cast<float>(operation.Data.value());
 					}
 
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.DoubleVisionStrength->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.DoubleVisionStrength->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
+					TransformKeys<InterpolatorT>(a_interpolatorData->AddVec.data(), a_interpolatorData->AddVec.size(), transform);
+					a_interpolatorData->TransformVec.emplace_back(transform);
 				}
-				else if (a_configData.Element == ElementType::kTintColor)
-				{
-					if (!patchData.TintColor.has_value())
-					{
-						patchData.TintColor = PatchData::ColorInterpolatorData{};
-					}
+			}
+		}
 
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.TintColor->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::ColorData>(operation.Data.value());
-							patchData.TintColor->AddVec.emplace_back(PatchData::ColorInterpolatorData::ColorData{ data.Time, { data.Red, data.Green, data.Blue, data.Alpha } });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kFadeColor)
-				{
-					if (!patchData.FadeColor.has_value())
-					{
-						patchData.FadeColor = PatchData::ColorInterpolatorData{};
-					}
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
+		{
+			if (a_configData.Element == ElementType::kAnimatable)
+			{
+				a_patchData.Animatable = std::any_cast<bool>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kDuration)
+			{
+				a_patchData.Duration = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kRadialBlurUseTarget)
+			{
+				a_patchData.RadialBlurUseTarget = std::any_cast<bool>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kRadialBlurCenterX)
+			{
+				a_patchData.RadialBlurCenterX = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kRadialBlurCenterY)
+			{
+				a_patchData.RadialBlurCenterY = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kDepthOfFieldUseTarget)
+			{
+				a_patchData.DepthOfFieldUseTarget = std::any_cast<bool>(a_configData.AssignValue.value());
+			}
+			else if (const auto floatIndex = FindInterpolator(kFloatInterpolators, a_configData.Element))
+			{
+				PrepareInterpolatorData(a_configData, a_patchData.FloatInterpolators[floatIndex.value()]);
+			}
+			else if (const auto colorIndex = FindInterpolator(kColorInterpolators, a_configData.Element))
+			{
+				PrepareInterpolatorData(a_configData, a_patchData.ColorInterpolators[colorIndex.value()]);
+			}
+			else
+			{
+				logger::warn("Invalid ElementName: '{}'.", ElementTypeToString(a_configData.Element));
+				return;
+			}
+		}
 
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.FadeColor->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::ColorData>(operation.Data.value());
-							patchData.FadeColor->AddVec.emplace_back(PatchData::ColorInterpolatorData::ColorData{ data.Time, { data.Red, data.Green, data.Blue, data.Alpha } });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kRadialBlurUseTarget)
-				{
-					patchData.RadialBlurUseTarget = std::any_cast<bool>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kRadialBlurCenterX)
+		std::vector<RE::TESImageSpaceModifier*> GetTargets(const ConfigData& a_configData)
+		{
+			return ConfigUtils::GetFilteredForms<RE::TESImageSpaceModifier>(a_configData, "an ImageSpaceAdapter");
+		}
+
+		template <typename InterpolatorT>
+		using KeyVector = std::vector<typename InterpolatorTraits<InterpolatorT>::key_type>;
+
+		template <typename InterpolatorT>
+		void AppendKeys(InterpolatorT* a_interpolator, KeyVector<InterpolatorT>& a_keys)
+		{
+			if (!a_interpolator)
+			{
+				return;
+			}
+
+			const auto& data = InterpolatorTraits<InterpolatorT>::GetData(a_interpolator);
+			if (!data || data->numKeys == 0 || !data->data)
+			{
+				return;
+			}
+
+			a_keys.insert(a_keys.end(), data->data, data->data + data->numKeys);
+		}
+
+		// Interpolation walks the keys in time order, so keys are stable-sorted by time and a later key
+		// replaces an earlier one with the same time.
+		template <typename KeyT>
+		void SortKeys(std::vector<KeyT>& a_keys)
+		{
+			std::stable_sort(a_keys.begin(), a_keys.end(), [](const KeyT& a_lhs, const KeyT& a_rhs) { return a_lhs.time < a_rhs.time; });
+
+			std::size_t writeIndex = 0;
+			for (std::size_t readIndex = 0; readIndex < a_keys.size(); ++readIndex)
+			{
+				if (writeIndex > 0 && a_keys[writeIndex - 1].time == a_keys[readIndex].time)
 				{
-					patchData.RadialBlurCenterX = std::any_cast<float>(a_configData.AssignValue.value());
+					a_keys[writeIndex - 1] = a_keys[readIndex];
 				}
-				else if (a_configData.Element == ElementType::kRadialBlurCenterY)
+				else
 				{
-					patchData.RadialBlurCenterY = std::any_cast<float>(a_configData.AssignValue.value());
+					a_keys[writeIndex++] = a_keys[readIndex];
 				}
-				else if (a_configData.Element == ElementType::kRadialBlurStrength)
+			}
+
+			a_keys.resize(writeIndex);
+		}
+
+		template <typename InterpolatorT>
+		void ResetInterpolator(const InterpolatorSlot<InterpolatorT>& a_slot)
+		{
+			a_slot.KeySize = 0;
+			if (a_slot.Interpolator)
+			{
+				auto& data = InterpolatorTraits<InterpolatorT>::GetData(a_slot.Interpolator.get());
+				if (data)
 				{
-					if (!patchData.RadialBlurStrength.has_value())
+					if (data->data)
 					{
-						patchData.RadialBlurStrength = PatchData::FloatInterpolatorData{};
+						RE::free(data->data);
+						data->data = nullptr;
 					}
+					data->numKeys = 0;
+					data->type = 0;
+					data->keySize = 0;
+				}
+			}
+			a_slot.Interpolator.reset();
+		}
 
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.RadialBlurStrength->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.RadialBlurStrength->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
+		template <typename InterpolatorT>
+		typename InterpolatorTraits<InterpolatorT>::data_type* GetOrCreateData(RE::NiPointer<InterpolatorT>& a_interpolator)
+		{
+			using Traits = InterpolatorTraits<InterpolatorT>;
+			using DataT = typename Traits::data_type;
+
+			if (!a_interpolator.get())
+			{
+				auto* storage = RE::malloc(sizeof(InterpolatorT));
+				if (!storage)
+				{
+					logger::error("Failed to allocate memory for {}.", Traits::kInterpolatorName);
+					return nullptr;
 				}
-				else if (a_configData.Element == ElementType::kRadialBlurRampUp)
+				a_interpolator = RE::NiPointer<InterpolatorT>(new (storage) InterpolatorT());
+			}
+
+			auto& data = Traits::GetData(a_interpolator.get());
+			if (!data)
+			{
+				auto* storage = RE::malloc(sizeof(DataT));
+				if (!storage)
 				{
-					if (!patchData.RadialBlurRampUp.has_value())
-					{
-						patchData.RadialBlurRampUp = PatchData::FloatInterpolatorData{};
-					}
+					logger::error("Failed to allocate memory for {}.", Traits::kDataName);
+					return nullptr;
+				}
+				data = RE::NiPointer<DataT>(new (storage) DataT());
+			}
 
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.RadialBlurRampUp->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.RadialBlurRampUp->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kRadialBlurRampDown)
-				{
-					if (!patchData.RadialBlurRampDown.has_value())
-					{
-						patchData.RadialBlurRampDown = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.RadialBlurRampDown->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.RadialBlurRampDown->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kRadialBlurStart)
-				{
-					if (!patchData.RadialBlurStart.has_value())
-					{
-						patchData.RadialBlurStart = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.RadialBlurStart->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.RadialBlurStart->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kRadialBlurDownStart)
-				{
-					if (!patchData.RadialBlurDownStart.has_value())
-					{
-						patchData.RadialBlurDownStart = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.RadialBlurDownStart->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.RadialBlurDownStart->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kDepthOfFieldUseTarget)
-				{
-					patchData.DepthOfFieldUseTarget = std::any_cast<bool>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kDepthOfFieldStrength)
-				{
-					if (!patchData.DepthOfFieldStrength.has_value())
-					{
-						patchData.DepthOfFieldStrength = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.DepthOfFieldStrength->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.DepthOfFieldStrength->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kDepthOfFieldDistance)
-				{
-					if (!patchData.DepthOfFieldDistance.has_value())
-					{
-						patchData.DepthOfFieldDistance = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.DepthOfFieldDistance->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.DepthOfFieldDistance->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kDepthOfFieldRange)
-				{
-					if (!patchData.DepthOfFieldRange.has_value())
-					{
-						patchData.DepthOfFieldRange = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.DepthOfFieldRange->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.DepthOfFieldRange->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kDepthOfFieldVignetteRadius)
-				{
-					if (!patchData.DepthOfFieldVignetteRadius.has_value())
-					{
-						patchData.DepthOfFieldVignetteRadius = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.DepthOfFieldVignetteRadius->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.DepthOfFieldVignetteRadius->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kDepthOfFieldVignetteStrength)
-				{
-					if (!patchData.DepthOfFieldVignetteStrength.has_value())
-					{
-						patchData.DepthOfFieldVignetteStrength = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.DepthOfFieldVignetteStrength->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.DepthOfFieldVignetteStrength->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kMotionBlurStrength)
-				{
-					if (!patchData.MotionBlurStrength.has_value())
-					{
-						patchData.MotionBlurStrength = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.MotionBlurStrength->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.MotionBlurStrength->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDREyeAdaptSpeedMult)
-				{
-					if (!patchData.HDREyeAdaptSpeedMult.has_value())
-					{
-						patchData.HDREyeAdaptSpeedMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDREyeAdaptSpeedMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDREyeAdaptSpeedMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDREyeAdaptSpeedAdd)
-				{
-					if (!patchData.HDREyeAdaptSpeedAdd.has_value())
-					{
-						patchData.HDREyeAdaptSpeedAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDREyeAdaptSpeedAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDREyeAdaptSpeedAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRBloomBlurRadiusMult)
-				{
-					if (!patchData.HDRBloomBlurRadiusMult.has_value())
-					{
-						patchData.HDRBloomBlurRadiusMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRBloomBlurRadiusMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRBloomBlurRadiusMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRBloomBlurRadiusAdd)
-				{
-					if (!patchData.HDRBloomBlurRadiusAdd.has_value())
-					{
-						patchData.HDRBloomBlurRadiusAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRBloomBlurRadiusAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRBloomBlurRadiusAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRBloomThresholdMult)
-				{
-					if (!patchData.HDRBloomThresholdMult.has_value())
-					{
-						patchData.HDRBloomThresholdMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRBloomThresholdMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRBloomThresholdMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRBloomThresholdAdd)
-				{
-					if (!patchData.HDRBloomThresholdAdd.has_value())
-					{
-						patchData.HDRBloomThresholdAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRBloomThresholdAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRBloomThresholdAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRBloomScaleMult)
-				{
-					if (!patchData.HDRBloomScaleMult.has_value())
-					{
-						patchData.HDRBloomScaleMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRBloomScaleMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRBloomScaleMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRBloomScaleAdd)
-				{
-					if (!patchData.HDRBloomScaleAdd.has_value())
-					{
-						patchData.HDRBloomScaleAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRBloomScaleAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRBloomScaleAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRTargetLumMinMult)
-				{
-					if (!patchData.HDRTargetLumMinMult.has_value())
-					{
-						patchData.HDRTargetLumMinMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRTargetLumMinMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRTargetLumMinMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRTargetLumMinAdd)
-				{
-					if (!patchData.HDRTargetLumMinAdd.has_value())
-					{
-						patchData.HDRTargetLumMinAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRTargetLumMinAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRTargetLumMinAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRTargetLumMaxMult)
-				{
-					if (!patchData.HDRTargetLumMaxMult.has_value())
-					{
-						patchData.HDRTargetLumMaxMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRTargetLumMaxMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRTargetLumMaxMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRTargetLumMaxAdd)
-				{
-					if (!patchData.HDRTargetLumMaxAdd.has_value())
-					{
-						patchData.HDRTargetLumMaxAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRTargetLumMaxAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRTargetLumMaxAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRSunlightScaleMult)
-				{
-					if (!patchData.HDRSunlightScaleMult.has_value())
-					{
-						patchData.HDRSunlightScaleMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRSunlightScaleMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRSunlightScaleMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRSunlightScaleAdd)
-				{
-					if (!patchData.HDRSunlightScaleAdd.has_value())
-					{
-						patchData.HDRSunlightScaleAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRSunlightScaleAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRSunlightScaleAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRSkyScaleMult)
-				{
-					if (!patchData.HDRSkyScaleMult.has_value())
-					{
-						patchData.HDRSkyScaleMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRSkyScaleMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRSkyScaleMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHDRSkyScaleAdd)
-				{
-					if (!patchData.HDRSkyScaleAdd.has_value())
-					{
-						patchData.HDRSkyScaleAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.HDRSkyScaleAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.HDRSkyScaleAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kCinematicSaturationMult)
-				{
-					if (!patchData.CinematicSaturationMult.has_value())
-					{
-						patchData.CinematicSaturationMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.CinematicSaturationMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.CinematicSaturationMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kCinematicSaturationAdd)
-				{
-					if (!patchData.CinematicSaturationAdd.has_value())
-					{
-						patchData.CinematicSaturationAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.CinematicSaturationAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.CinematicSaturationAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kCinematicBrightnessMult)
-				{
-					if (!patchData.CinematicBrightnessMult.has_value())
-					{
-						patchData.CinematicBrightnessMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.CinematicBrightnessMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.CinematicBrightnessMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kCinematicBrightnessAdd)
-				{
-					if (!patchData.CinematicBrightnessAdd.has_value())
-					{
-						patchData.CinematicBrightnessAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.CinematicBrightnessAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.CinematicBrightnessAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kCinematicContrastMult)
-				{
-					if (!patchData.CinematicContrastMult.has_value())
-					{
-						patchData.CinematicContrastMult = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.CinematicContrastMult->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.CinematicContrastMult->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kCinematicContrastAdd)
-				{
-					if (!patchData.CinematicContrastAdd.has_value())
-					{
-						patchData.CinematicContrastAdd = PatchData::FloatInterpolatorData{};
-					}
-
-					for (const auto& operation : a_configData.Operations)
-					{
-						if (operation.Type == OperationType::kClear)
-						{
-							patchData.CinematicContrastAdd->Clear = true;
-						}
-						else if (operation.Type == OperationType::kAdd)
-						{
-							const auto data = std::any_cast<ConfigData::Operation::FloatData>(operation.Data.value());
-							patchData.CinematicContrastAdd->AddVec.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data.Time, data.Value });
-						}
-					}
-				}
-				else
-				{
-					logger::warn("Invalid ElementName: '{}'.", ElementTypeToString(a_configData.Element));
-					return;
-				}
-			}
+			return data.get();
 		}
 
-		std::vector<PatchData::FloatInterpolatorData::FloatData> GetFloatData(RE::NiFloatInterpolator* a_interpolator)
+		// Each key array gets its own allocation, as the engine's loader gives it, since NiFloatData and NiColorData
+		// free their key array on destruction and a later Clear frees it here as well.
+		template <typename InterpolatorT>
+		void InstallKeys(const InterpolatorSlot<InterpolatorT>& a_slot, const KeyVector<InterpolatorT>& a_keys)
 		{
-			if (!a_interpolator || !a_interpolator->floatData)
-			{
-				return {};
-			}
-
-			const auto numKeys = a_interpolator->floatData->numKeys;
-			const auto* data = a_interpolator->floatData->data;
-			if (numKeys == 0 || !data)
-			{
-				return {};
-			}
+			using Traits = InterpolatorTraits<InterpolatorT>;
+			using KeyT = typename Traits::key_type;
 
-			std::vector<PatchData::FloatInterpolatorData::FloatData> floatData;
-			floatData.reserve(numKeys);
-
-			for (std::uint32_t floatIndex = 0; floatIndex < numKeys; ++floatIndex)
-			{
-				floatData.emplace_back(PatchData::FloatInterpolatorData::FloatData{ data[floatIndex].time, data[floatIndex].value });
-			}
-
-			return floatData;
-		}
-
-		std::vector<PatchData::ColorInterpolatorData::ColorData> GetColorData(RE::NiColorInterpolator* a_interpolator)
-		{
-			if (!a_interpolator || !a_interpolator->colorData)
+			auto* data = GetOrCreateData(a_slot.Interpolator);
+			if (!data)
 			{
-				return {};
+				return;
 			}
 
-			const auto numKeys = a_interpolator->colorData->numKeys;
-			const auto* data = a_interpolator->colorData->data;
-			if (numKeys == 0 || !data)
+			auto* keyStorage = static_cast<KeyT*>(RE::malloc(sizeof(KeyT) * a_keys.size()));
+			if (!keyStorage)
 			{
-				return {};
+				logger::error("Failed to allocate memory for the keys of {}.", Traits::kDataName);
+				return;
 			}
 
-			std::vector<PatchData::ColorInterpolatorData::ColorData> colorData;
-			colorData.reserve(numKeys);
+			std::copy(a_keys.begin(), a_keys.end(), keyStorage);
 
-			for (std::uint32_t colorIndex = 0; colorIndex < numKeys; ++colorIndex)
+			if (data->data)
 			{
-				colorData.emplace_back(PatchData::ColorInterpolatorData::ColorData{ data[colorIndex].time, data[colorIndex].color });
+				RE::free(data->data);
 			}
 
-			return colorData;
+			a_slot.KeySize = static_cast<std::uint32_t>(a_keys.size());
+			a_slot.Interpolator->lastIndex = 0;
+			data->numKeys = static_cast<std::uint32_t>(a_keys.size());
+			data->data = keyStorage;
+			data->type = 1;
+			data->keySize = sizeof(KeyT);
 		}
 
-		void SetFloatData(std::uint32_t& a_keySize, RE::NiPointer<RE::NiFloatInterpolator>& a_interpolator, const std::vector<PatchData::FloatInterpolatorData::FloatData>& a_floatDataVec)
+		// Builds the final key list of every patched interpolator and installs it. The curve's own keys get every
+		// transform; added keys were already transformed by the ones listed after them. Interpolators left without
+		// keys are released.
+		template <typename InterpolatorT, std::size_t N>
+		void PatchKeys(RE::TESImageSpaceModifier* a_imageSpaceAdapter, const std::array<InterpolatorDescriptor<InterpolatorT>, N>& a_descriptors, const std::array<std::optional<PatchData::InterpolatorData<InterpolatorT>>, N>& a_interpolatorDataArray)
 		{
-			if (a_floatDataVec.empty())
-			{
-				a_keySize = 0;
-
-				if (a_interpolator && a_interpolator->floatData)
-				{
-					if (a_interpolator->floatData->data)
-					{
-						RE::free(a_interpolator->floatData->data);
-						a_interpolator->floatData->data = nullptr;
-					}
-
-					a_interpolator->floatData->numKeys = 0;
-					a_interpolator->floatData->type = 0;
-					a_interpolator->floatData->keySize = 0;
-				}
-
-				a_interpolator.reset();
-				return;
-			}
-
-			if (!a_interpolator.get())
+			for (std::size_t descriptorIndex = 0; descriptorIndex < N; ++descriptorIndex)
 			{
-				auto* storage = RE::malloc(sizeof(RE::NiFloatInterpolator));
-				if (!storage)
+				const auto& interpolatorData = a_interpolatorDataArray[descriptorIndex];
+				if (!interpolatorData.has_value())
 				{
-					logger::error("Failed to allocate memory for NiFloatInterpolator.");
-					return;
+					continue;
 				}
-				a_interpolator = RE::NiPointer<RE::NiFloatInterpolator>(new (storage) RE::NiFloatInterpolator());
-			}
 
-			if (!a_interpolator->floatData)
-			{
-				auto* storage = RE::malloc(sizeof(RE::NiFloatData));
-				if (!storage)
+				const bool editsKeys = interpolatorData->Clear || !interpolatorData->AddVec.empty();
+				if (!editsKeys && interpolatorData->TransformVec.empty())
 				{
-					logger::error("Failed to allocate memory for NiFloatData.");
-					return;
+					continue;
 				}
-				a_interpolator->floatData = RE::NiPointer<RE::NiFloatData>(new (storage) RE::NiFloatData());
-			}
-
-			if (a_interpolator->floatData->data)
-			{
-				RE::free(a_interpolator->floatData->data);
-				a_interpolator->floatData->data = nullptr;
-			}
-
-			auto* dataStorage = RE::malloc(sizeof(RE::NiFloatData::Data) * a_floatDataVec.size());
-			if (!dataStorage)
-			{
-				logger::error("Failed to allocate memory for NiFloatData::Data.");
-				return;
-			}
-
-			for (std::size_t floatIndex = 0; floatIndex < a_floatDataVec.size(); ++floatIndex)
-			{
-				const auto& [time, value] = a_floatDataVec[floatIndex];
-				auto& data = reinterpret_cast<RE::NiFloatData::Data*>(dataStorage)[floatIndex];
-				data.time = time;
-				data.value = value;
-			}
 
-			a_keySize = static_cast<std::uint32_t>(a_floatDataVec.size());
-
-			a_interpolator->floatData->numKeys = static_cast<std::uint32_t>(a_floatDataVec.size());
-			a_interpolator->floatData->data = reinterpret_cast<RE::NiFloatData::Data*>(dataStorage);
-			a_interpolator->floatData->type = 1;
-			a_interpolator->floatData->keySize = sizeof(RE::NiFloatData::Data);
-		}
-
-		void SetColorData(std::uint32_t& a_keySize, RE::NiPointer<RE::NiColorInterpolator>& a_interpolator, const std::vector<PatchData::ColorInterpolatorData::ColorData>& a_colorDataVec)
-		{
-			if (a_colorDataVec.empty())
-			{
-				a_keySize = 0;
+				const auto slot = a_descriptors[descriptorIndex].GetSlot(a_imageSpaceAdapter);
 
-				if (a_interpolator && a_interpolator->colorData)
+				KeyVector<InterpolatorT> keys;
+				if (!interpolatorData->Clear)
 				{
-					if (a_interpolator->colorData->data)
+					AppendKeys(slot.Interpolator.get(), keys);
+					for (const auto& transform : interpolatorData->TransformVec)
 					{
-						RE::free(a_interpolator->colorData->data);
-						a_interpolator->colorData->data = nullptr;
+						TransformKeys<InterpolatorT>(keys.data(), keys.size(), transform);
 					}
-
-					a_interpolator->colorData->numKeys = 0;
-					a_interpolator->colorData->type = 0;
-					a_interpolator->colorData->keySize = 0;
 				}
 
-				a_interpolator.reset();
-				return;
-			}
-
-			if (!a_interpolator.get())
-			{
-				auto* storage = RE::malloc(sizeof(RE::NiColorInterpolator));
-				if (!storage)
+				if (!editsKeys && keys.empty())
 				{
-					logger::error("Failed to allocate memory for NiColorInterpolator.");
-					return;
+					continue;
 				}
-				a_interpolator = RE::NiPointer<RE::NiColorInterpolator>(new (storage) RE::NiColorInterpolator());
-			}
 
-			if (!a_interpolator->colorData)
-			{
-				auto* storage = RE::malloc(sizeof(RE::NiColorData));
-				if (!storage)
+				keys.insert(keys.end(), interpolatorData->AddVec.begin(), interpolatorData->AddVec.end());
+				SortKeys(keys);
+
+				if (keys.empty())
 				{
-					logger::error("Failed to allocate memory for NiColorData.");
-					return;
+					ResetInterpolator(slot);
+					continue;
 				}
-				a_interpolator->colorData = RE::NiPointer<RE::NiColorData>(new (storage) RE::NiColorData());
-			}
-
-			if (a_interpolator->colorData->data)
-			{
-				RE::free(a_interpolator->colorData->data);
-				a_interpolator->colorData->data = nullptr;
-			}
-
-			auto* dataStorage = RE::malloc(sizeof(RE::NiColorData::Data) * a_colorDataVec.size());
-			if (!dataStorage)
-			{
-				logger::error("Failed to allocate memory for NiColorData::Data.");
-				return;
-			}
-
-			for (std::size_t colorIndex = 0; colorIndex < a_colorDataVec.size(); ++colorIndex)
-			{
-				const auto& [time, color] = a_colorDataVec[colorIndex];
-				auto& data = reinterpret_cast<RE::NiColorData::Data*>(dataStorage)[colorIndex];
-				data.time = time;
-				data.color = color;
-			}
-
-			a_keySize = static_cast<std::uint32_t>(a_colorDataVec.size());
-
-			a_interpolator->colorData->numKeys = static_cast<std::uint32_t>(a_colorDataVec.size());
-			a_interpolator->colorData->data = reinterpret_cast<RE::NiColorData::Data*>(dataStorage);
-			a_interpolator->colorData->type = 1;
-			a_interpolator->colorData->keySize = sizeof(RE::NiColorData::Data);
-		}
-
-		void PatchFloatInterpolator(std::uint32_t& a_keySize, RE::NiPointer<RE::NiFloatInterpolator>& a_interpolator, const PatchData::FloatInterpolatorData& a_floatInterpolatorData)
-		{
-			bool cleared = false, added = false;
-			std::vector<PatchData::FloatInterpolatorData::FloatData> floatDataVec;
-
-			if (a_floatInterpolatorData.Clear)
-			{
-				cleared = true;
-			}
-			else
-			{
-				floatDataVec = GetFloatData(a_interpolator.get());
-			}
-
-			for (const auto& data : a_floatInterpolatorData.AddVec)
-			{
-				floatDataVec.emplace_back(data);
-				added = true;
-			}
 
-			if (cleared || added)
-			{
-				SetFloatData(a_keySize, a_interpolator, floatDataVec);
+				InstallKeys(slot, keys);
 			}
 		}
 
-		void PatchColorInterpolator(std::uint32_t& a_keySize, RE::NiPointer<RE::NiColorInterpolator>& a_interpolator, const PatchData::ColorInterpolatorData& a_tintColorData)
+		void PatchInterpolators(RE::TESImageSpaceModifier* a_imageSpaceAdapter, const PatchData& a_patchData)
 		{
-			bool cleared = false, added = false;
-			std::vector<PatchData::ColorInterpolatorData::ColorData> colorDataVec;
-
-			if (a_tintColorData.Clear)
-			{
-				cleared = true;
-			}
-			else
-			{
-				colorDataVec = GetColorData(a_interpolator.get());
-			}
-
-			for (const auto& data : a_tintColorData.AddVec)
-			{
-				colorDataVec.emplace_back(data);
-				added = true;
-			}
-
-			if (cleared || added)
-			{
-				SetColorData(a_keySize, a_interpolator, colorDataVec);
-			}
+			PatchKeys(a_imageSpaceAdapter, kFloatInterpolators, a_patchData.FloatInterpolators);
+			PatchKeys(a_imageSpaceAdapter, kColorInterpolators, a_patchData.ColorInterpolators);
 		}
 	}  // namespace
 
@@ -2160,7 +1604,8 @@ namespace ImageSpaceAdapters
 	{
 		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
 
-		ConfigUtils::Prepare(g_configVec, Prepare);
+		ConfigUtils::Prepare(g_configVec, g_patchMap, GetTargets, PreparePatchData);
+		g_patchMap.Freeze();
 
 		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
 		logger::info("");
@@ -2179,26 +1624,6 @@ namespace ImageSpaceAdapters
 				imageSpaceAdapter->data.duration = patchData.Duration.value();
 			}
 
-			if (patchData.BlurRadius.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.blurKeySize, imageSpaceAdapter->blurInterpolator, patchData.BlurRadius.value());
-			}
-
-			if (patchData.DoubleVisionStrength.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.doubleKeySize, imageSpaceAdapter->doubleInterpolator, patchData.DoubleVisionStrength.value());
-			}
-
-			if (patchData.TintColor.has_value())
-			{
-				PatchColorInterpolator(imageSpaceAdapter->data.tintColorKeySize, imageSpaceAdapter->tintColorInterpolator, patchData.TintColor.value());
-			}
-
-			if (patchData.FadeColor.has_value())
-			{
-				PatchColorInterpolator(imageSpaceAdapter->data.fadeColorKeySize, imageSpaceAdapter->fadeColorInterpolator, patchData.FadeColor.value());
-			}
-
 			if (patchData.RadialBlurUseTarget.has_value())
 			{
 				imageSpaceAdapter->data.useTargetForRadialBlur = patchData.RadialBlurUseTarget.value();
@@ -2214,175 +1639,12 @@ namespace ImageSpaceAdapters
 				imageSpaceAdapter->data.radialBlurCenter.y = patchData.RadialBlurCenterY.value();
 			}
 
-			if (patchData.RadialBlurStrength.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.radialBlurStrengthKeySize, imageSpaceAdapter->radialBlurStrengthInterpolator, patchData.RadialBlurStrength.value());
-			}
-
-			if (patchData.RadialBlurRampUp.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.radialBlurRampupKeySize, imageSpaceAdapter->radialBlurRampupInterpolator, patchData.RadialBlurRampUp.value());
-			}
-
-			if (patchData.RadialBlurRampDown.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.radialBlurRampDownKeySize, imageSpaceAdapter->radialBlurRampDownInterpolator, patchData.RadialBlurRampDown.value());
-			}
-
-			if (patchData.RadialBlurStart.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.radialBlurStartKeySize, imageSpaceAdapter->radialBlurStartInterpolator, patchData.RadialBlurStart.value());
-			}
-
-			if (patchData.RadialBlurDownStart.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.radialBlurDownStartKeySize, imageSpaceAdapter->radialBlurDownStartInterpolator, patchData.RadialBlurDownStart.value());
-			}
-
 			if (patchData.DepthOfFieldUseTarget.has_value())
 			{
 				imageSpaceAdapter->data.useTargetForDepthOfField = patchData.DepthOfFieldUseTarget.value();
 			}
 
-			if (patchData.DepthOfFieldStrength.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.depthOfFieldStrengthKeySize, imageSpaceAdapter->depthOfFieldStrengthInterpolator, patchData.DepthOfFieldStrength.value());
-			}
-
-			if (patchData.DepthOfFieldDistance.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.depthOfFieldDistanceKeySize, imageSpaceAdapter->depthOfFieldDistanceInterpolator, patchData.DepthOfFieldDistance.value());
-			}
-
-			if (patchData.DepthOfFieldRange.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.depthOfFieldRangeKeySize, imageSpaceAdapter->depthOfFieldRangeInterpolator, patchData.DepthOfFieldRange.value());
-			}
-
-			if (patchData.DepthOfFieldVignetteRadius.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.depthOfFieldVignetteRadiusKeySize, imageSpaceAdapter->depthOfFieldVignetteRadiusInterpolator, patchData.DepthOfFieldVignetteRadius.value());
-			}
-
-			if (patchData.DepthOfFieldVignetteStrength.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.depthOfFieldVignetteStrengthKeySize, imageSpaceAdapter->depthOfFieldVignetteStrengthInterpolator, patchData.DepthOfFieldVignetteStrength.value());
-			}
-
-			if (patchData.MotionBlurStrength.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.motionBlurStrengthKeySize, imageSpaceAdapter->motionBlurStrengthInterpolator, patchData.MotionBlurStrength.value());
-			}
-
-			if (patchData.HDREyeAdaptSpeedMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[0][0], imageSpaceAdapter->interpolator[0][0], patchData.HDREyeAdaptSpeedMult.value());
-			}
-
-			if (patchData.HDREyeAdaptSpeedAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[0][1], imageSpaceAdapter->interpolator[0][1], patchData.HDREyeAdaptSpeedAdd.value());
-			}
-
-			if (patchData.HDRBloomBlurRadiusMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[1][0], imageSpaceAdapter->interpolator[1][0], patchData.HDRBloomBlurRadiusMult.value());
-			}
-
-			if (patchData.HDRBloomBlurRadiusAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[1][1], imageSpaceAdapter->interpolator[1][1], patchData.HDRBloomBlurRadiusAdd.value());
-			}
-
-			if (patchData.HDRBloomThresholdMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[2][0], imageSpaceAdapter->interpolator[2][0], patchData.HDRBloomThresholdMult.value());
-			}
-
-			if (patchData.HDRBloomThresholdAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[2][1], imageSpaceAdapter->interpolator[2][1], patchData.HDRBloomThresholdAdd.value());
-			}
-
-			if (patchData.HDRBloomScaleMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[3][0], imageSpaceAdapter->interpolator[3][0], patchData.HDRBloomScaleMult.value());
-			}
-
-			if (patchData.HDRBloomScaleAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[3][1], imageSpaceAdapter->interpolator[3][1], patchData.HDRBloomScaleAdd.value());
-			}
-
-			if (patchData.HDRTargetLumMinMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[4][0], imageSpaceAdapter->interpolator[4][0], patchData.HDRTargetLumMinMult.value());
-			}
-
-			if (patchData.HDRTargetLumMinAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[4][1], imageSpaceAdapter->interpolator[4][1], patchData.HDRTargetLumMinAdd.value());
-			}
-
-			if (patchData.HDRTargetLumMaxMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[5][0], imageSpaceAdapter->interpolator[5][0], patchData.HDRTargetLumMaxMult.value());
-			}
-
-			if (patchData.HDRTargetLumMaxAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[5][1], imageSpaceAdapter->interpolator[5][1], patchData.HDRTargetLumMaxAdd.value());
-			}
-
-			if (patchData.HDRSunlightScaleMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[6][0], imageSpaceAdapter->interpolator[6][0], patchData.HDRSunlightScaleMult.value());
-			}
-
-			if (patchData.HDRSunlightScaleAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[6][1], imageSpaceAdapter->interpolator[6][1], patchData.HDRSunlightScaleAdd.value());
-			}
-
-			if (patchData.HDRSkyScaleMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[7][0], imageSpaceAdapter->interpolator[7][0], patchData.HDRSkyScaleMult.value());
-			}
-
-			if (patchData.HDRSkyScaleAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[7][1], imageSpaceAdapter->interpolator[7][1], patchData.HDRSkyScaleAdd.value());
-			}
-
-			if (patchData.CinematicSaturationMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[17][0], imageSpaceAdapter->interpolator[17][0], patchData.CinematicSaturationMult.value());
-			}
-
-			if (patchData.CinematicSaturationAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[17][1], imageSpaceAdapter->interpolator[17][1], patchData.CinematicSaturationAdd.value());
-			}
-
-			if (patchData.CinematicBrightnessMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[18][0], imageSpaceAdapter->interpolator[18][0], patchData.CinematicBrightnessMult.value());
-			}
-
-			if (patchData.CinematicBrightnessAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[18][1], imageSpaceAdapter->interpolator[18][1], patchData.CinematicBrightnessAdd.value());
-			}
-
-			if (patchData.CinematicContrastMult.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[19][0], imageSpaceAdapter->interpolator[19][0], patchData.CinematicContrastMult.value());
-			}
-
-			if (patchData.CinematicContrastAdd.has_value())
-			{
-				PatchFloatInterpolator(imageSpaceAdapter->data.keySize[19][1], imageSpaceAdapter->interpolator[19][1], patchData.CinematicContrastAdd.value());
-			}
+			PatchInterpolators(imageSpaceAdapter, patchData);
 		}
 
 		logger::info("======================== Finished patching for {} ========================", kTypeName);
@@ -1,708 +1,700 @@
-#include "MusicTypes.h"
-
-#include <any>
-#include <regex>
-
-#include "ConfigUtils.h"
-#include "Parsers.h"
-#include "Utils.h"
-
-namespace MusicTypes
-{
-	namespace
-	{
-		constexpr std::string_view kTypeName = "MusicType";
-
-		enum class FilterType
-		{
-			kFormID
-		};
-
-		std::string_view FilterTypeToString(FilterType a_value)
-		{
-			switch (a_value)
-			{
-			case FilterType::kFormID:
-				return "FilterByFormID";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		enum class ElementType
-		{
-			kDucking,
-			kFadeDuration,
-			kFlags,
-			kMusicTracks,
-			kPriority
-		};
-
-		std::string_view ElementTypeToString(ElementType a_value)
-		{
-			switch (a_value)
-			{
-			case ElementType::kDucking:
-				return "Ducking";
-			case ElementType::kFadeDuration:
-				return "FadeDuration";
-			case ElementType::kFlags:
-				return "Flags";
-			case ElementType::kMusicTracks:
-				return "MusicTracks";
-			case ElementType::kPriority:
-				return "Priority";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		enum class OperationType
-		{
-			kClear,
-			kAdd,
-			kDelete
-		};
-
-		std::string_view OperationTypeToString(OperationType a_value)
-		{
-			switch (a_value)
-			{
-			case OperationType::kClear:
-				return "Clear";
-			case OperationType::kAdd:
-				return "Add";
-			case OperationType::kDelete:
-				return "Delete";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		struct ConfigData
-		{
-			struct Operation
-			{
-				OperationType OpType;
-				std::optional<std::string> OpForm;
-			};
-
-			FilterType Filter;
-			std::string FilterForm;
-			ElementType Element;
-			std::vector<Operation> Operations;
-			std::optional<std::any> AssignValue;
-		};
-
-		struct PatchData
-		{
-			struct MusicTracksData
-			{
-				bool Clear = false;
-				std::vector<RE::BGSMusicTrackFormWrapper*> AddTrackVec;
-				std::vector<RE::BGSMusicTrackFormWrapper*> DeleteTrackVec;
-			};
-
-			std::optional<std::uint16_t> Ducking;
-			std::optional<float> FadeDuration;
-			std::optional<std::uint32_t> Flags;
-			std::optional<MusicTracksData> MusicTracks;
-			std::optional<std::uint8_t> Priority;
-		};
-
-		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::BGSMusicType*, PatchData> g_patchMap;
-
-		class MusicTypeParser : public Parsers::Parser<ConfigData>
-		{
-		public:
-			MusicTypeParser(std::string_view a_configPath) : Parsers::Parser<ConfigData>(a_configPath) {}
-
-		protected:
-			std::optional<Parsers::Statement<ConfigData>> ParseExpressionStatement() override
-			{
-				ConfigData configData{};
-
-				if (!ParseFilter(configData))
-				{
-					return std::nullopt;
-				}
-
-				auto token = reader.GetToken();
-				if (token != ".")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				if (!ParseElement(configData))
-				{
-					return std::nullopt;
-				}
-
-				token = reader.Peek();
-				if (token == "=")
-				{
-					if (!ParseAssignment(configData))
-					{
-						return std::nullopt;
-					}
-				}
-				else
-				{
-					do
-					{
-						token = reader.GetToken();
-						if (token != ".")
-						{
-							logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
-							return std::nullopt;
-						}
-
-						if (!ParseOperation(configData))
-						{
-							return std::nullopt;
-						}
-					} while (reader.Peek() == ".");
-				}
-
-				token = reader.GetToken();
-				if (token != ";")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ';'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				return Parsers::Statement<ConfigData>::CreateExpressionStatement(configData);
-			}
-
-			void PrintExpressionStatement(const ConfigData& a_configData, int a_indent) override
-			{
-				auto indent = std::string(a_indent * 4, ' ');
-
-				switch (a_configData.Element)
-				{
-				case ElementType::kDucking:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
-						static_cast<float>(std::any_cast<std::uint16_t>(a_configData.AssignValue.value())) / 100.0f);
-					break;
-
-				case ElementType::kFadeDuration:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
-						std::any_cast<float>(a_configData.AssignValue.value()));
-					break;
-
-				case ElementType::kFlags:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
-						GetFlags(std::any_cast<std::uint32_t>(a_configData.AssignValue.value())));
-					break;
-
-				case ElementType::kMusicTracks:
-					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
-					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
-					{
-						std::string opLog;
-
-						switch (a_configData.Operations[opIndex].OpType)
-						{
-						case OperationType::kClear:
-							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
-							break;
-
-						case OperationType::kAdd:
-						case OperationType::kDelete:
-							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType), a_configData.Operations[opIndex].OpForm.value());
-							break;
-						}
-
-						if (opIndex == a_configData.Operations.size() - 1)
-						{
-							opLog += ";";
-						}
-
-						logger::info("{}    {}", indent, opLog);
-					}
-					break;
-
-				case ElementType::kPriority:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
-						std::any_cast<std::uint8_t>(a_configData.AssignValue.value()));
-					break;
-				}
-			}
-
-			bool ParseFilter(ConfigData& a_configData)
-			{
-				auto token = reader.GetToken();
-				if (token == "FilterByFormID")
-				{
-					a_configData.Filter = FilterType::kFormID;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				token = reader.GetToken();
-				if (token != "(")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				const auto filterFormOpt = ParseForm();
-				if (!filterFormOpt.has_value())
-				{
-					return false;
-				}
-
-				a_configData.FilterForm = filterFormOpt.value();
-
-				token = reader.GetToken();
-				if (token != ")")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseElement(ConfigData& a_configData)
-			{
-				const auto token = reader.GetToken();
-				if (token == "Ducking")
-				{
-					a_configData.Element = ElementType::kDucking;
-				}
-				else if (token == "FadeDuration")
-				{
-					a_configData.Element = ElementType::kFadeDuration;
-				}
-				else if (token == "Flags")
-				{
-					a_configData.Element = ElementType::kFlags;
-				}
-				else if (token == "MusicTracks")
-				{
-					a_configData.Element = ElementType::kMusicTracks;
-				}
-				else if (token == "Priority")
-				{
-					a_configData.Element = ElementType::kPriority;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid ElementName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseAssignment(ConfigData& a_configData)
-			{
-				auto token = reader.GetToken();
-				if (token != "=")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '='.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				if (a_configData.Element == ElementType::kDucking)
-				{
-					const auto parsedValueOpt = ParseNumber<float>();
-					if (!parsedValueOpt.has_value())
-					{
-						return false;
-					}
-
-					if (parsedValueOpt.value() < 0.0f || parsedValueOpt.value() > 655.35f)
-					{
-						logger::warn("Line {}, Col {}: Failed to parse value '{}'. The value is out of range", reader.GetLastLine(), reader.GetLastLineIndex(), parsedValueOpt.value());
-						return false;
-					}
-
-					const auto value = static_cast<std::uint16_t>(std::round(parsedValueOpt.value() * 100.0f));
-					a_configData.AssignValue = std::any(value);
-				}
-				else if (a_configData.Element == ElementType::kFadeDuration)
-				{
-					const auto parsedValueOpt = ParseNumber<float>();
-					if (!parsedValueOpt.has_value())
-					{
-						return false;
-					}
-
-					a_configData.AssignValue = std::any(parsedValueOpt.value());
-				}
-				else if (a_configData.Element == ElementType::kFlags)
-				{
-					std::uint32_t flagValue = 0;
-
-					auto flag = ParseFlag();
-					if (!flag.has_value())
-					{
-						return false;
-					}
-					flagValue |= flag.value();
-
-					while (reader.Peek() == "|")
-					{
-						token = reader.GetToken();
-
-						flag = ParseFlag();
-						if (!flag.has_value())
-						{
-							return false;
-						}
-						flagValue |= flag.value();
-					}
-
-					a_configData.AssignValue = std::any(flagValue);
-				}
-				else if (a_configData.Element == ElementType::kPriority)
-				{
-					const auto priorityOpt = ParseNumber<std::uint8_t>();
-					if (!priorityOpt.has_value())
-					{
-						return false;
-					}
-
-					a_configData.AssignValue = std::any(priorityOpt.value());
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid Assignment for '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element));
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseOperation(ConfigData& a_configData)
-			{
-				ConfigData::Operation newOp{};
-
-				auto token = reader.GetToken();
-				if (token == "Clear")
-				{
-					newOp.OpType = OperationType::kClear;
-				}
-				else if (token == "Add")
-				{
-					newOp.OpType = OperationType::kAdd;
-				}
-				else if (token == "Delete")
-				{
-					newOp.OpType = OperationType::kDelete;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
-					if (elem == ElementType::kMusicTracks)
-					{
-						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
-					}
-					return false;
-				}(a_configData.Element, newOp.OpType);
-
-				if (!isValidOperation)
-				{
-					logger::warn("Line {}, Col {}: Invalid Operation '{}.{}()'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element), OperationTypeToString(newOp.OpType));
-					return false;
-				}
-
-				token = reader.GetToken();
-				if (token != "(")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				switch (a_configData.Element)
-				{
-				case ElementType::kMusicTracks:
-					if (newOp.OpType != OperationType::kClear)
-					{
-						const auto formOpt = ParseForm();
-						if (!formOpt.has_value())
-						{
-							return false;
-						}
-
-						newOp.OpForm = formOpt.value();
-					}
-
-					break;
-				}
-
-				token = reader.GetToken();
-				if (token != ")")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				a_configData.Operations.emplace_back(newOp);
-
-				return true;
-			}
-
-			std::optional<std::uint32_t> ParseFlag()
-			{
-				const auto token = reader.GetToken();
-				if (token.empty())
-				{
-					logger::warn("Line {}, Col {}: Expected flag.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				if (token == "None")
-				{
-					return 0x0000;
-				}
-				else if (token == "PlaysOneSelection")
-				{
-					return 0x0001;
-				}
-				else if (token == "AbruptTransition")
-				{
-					return 0x0002;
-				}
-				else if (token == "CycleTracks")
-				{
-					return 0x0004;
-				}
-				else if (token == "MaintainTrackOrder")
-				{
-					return 0x0008;
-				}
-				else if (token == "DucksCurrentTrack")
-				{
-					return 0x0020;
-				}
-				else if (token == "DoesNotQueue")
-				{
-					return 0x0040;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid flag '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return std::nullopt;
-				}
-			}
-
-			std::string GetFlags(std::uint32_t a_flags)
-			{
-				static constexpr std::string_view kSeparator = " | ";
-
-				std::string flags;
-
-				if (a_flags & 0x0001)
-				{
-					flags += "PlaysOneSelection | ";
-				}
-				if (a_flags & 0x0002)
-				{
-					flags += "AbruptTransition | ";
-				}
-				if (a_flags & 0x0004)
-				{
-					flags += "CycleTracks | ";
-				}
-				if (a_flags & 0x0008)
-				{
-					flags += "MaintainTrackOrder | ";
-				}
-				if (a_flags & 0x0020)
-				{
-					flags += "DucksCurrentTrack | ";
-				}
-				if (a_flags & 0x0040)
-				{
-					flags += "DoesNotQueue | ";
-				}
-
-				if (flags.empty())
-				{
-					return "None";
-				}
-
-				return flags.substr(0, flags.size() - kSeparator.size());
-			}
-		};
-
-		void Prepare(const ConfigData& a_configData)
-		{
-			if (a_configData.Filter == FilterType::kFormID)
-			{
-				auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-				if (!filterForm)
-				{
-					logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-					return;
-				}
-
-				auto* musicType = filterForm->As<RE::BGSMusicType>();
-				if (!musicType)
-				{
-					logger::warn("'{}' is not a MusicType.", a_configData.FilterForm);
-					return;
-				}
-
-				auto& patchData = g_patchMap[musicType];
-
-				if (a_configData.Element == ElementType::kDucking)
-				{
-					patchData.Ducking = std::any_cast<std::uint16_t>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFadeDuration)
-				{
-					patchData.FadeDuration = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kFlags)
-				{
-					patchData.Flags = std::any_cast<std::uint32_t>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kMusicTracks)
-				{
-					if (!patchData.MusicTracks.has_value())
-					{
-						patchData.MusicTracks = PatchData::MusicTracksData{};
-					}
-
-					for (const auto& op : a_configData.Operations)
-					{
-						if (op.OpType == OperationType::kClear)
-						{
-							patchData.MusicTracks->Clear = true;
-						}
-						else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
-						{
-							auto* opForm = Utils::GetFormFromString(op.OpForm.value());
-							if (!opForm)
-							{
-								logger::warn("Invalid Form: '{}'.", op.OpForm.value());
-								continue;
-							}
-
-							auto* musicTrack = opForm->As<RE::BGSMusicTrackFormWrapper>();
-							if (!musicTrack)
-							{
-								logger::warn("'{}' is not a MusicTrack.", op.OpForm.value());
-								continue;
-							}
-
-							if (op.OpType == OperationType::kAdd)
-							{
-								patchData.MusicTracks->AddTrackVec.emplace_back(musicTrack);
-							}
-							else
-							{
-								patchData.MusicTracks->DeleteTrackVec.emplace_back(musicTrack);
-							}
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kPriority)
-				{
-					patchData.Priority = std::any_cast<std::uint8_t>(a_configData.AssignValue.value());
-				}
-			}
-		}
-
-		void PatchMusicTracks(RE::BGSMusicType* a_musicType, const PatchData::MusicTracksData& a_musicTracksData)
-		{
-			bool cleared = false;
-
-			// Clear
-			if (a_musicTracksData.Clear)
-			{
-				a_musicType->tracks.clear();
-				cleared = true;
-			}
-
-			class RE::BGSMusicTrack;
-
-			// Delete
-			if (!cleared)
-			{
-				for (const auto& delForm : a_musicTracksData.DeleteTrackVec)
-				{
-					for (auto it = a_musicType->tracks.begin(); it != a_musicType->tracks.end(); ++it)
-					{
-						auto* musicTrack = RE::fallout_cast<RE::BGSMusicTrackFormWrapper*, RE::BSIMusicTrack>(*it);
-						if (musicTrack && musicTrack == delForm)
-						{
-							a_musicType->tracks.erase(it);
-							break;
-						}
-					}
-				}
-			}
-
-			// Add
-			for (const auto& addForm : a_musicTracksData.AddTrackVec)
-			{
-				auto* musicTrack = addForm->As<RE::BSIMusicTrack>();
-				if (musicTrack)
-				{
-					a_musicType->tracks.emplace_back(musicTrack);
-				}
-			}
-		}
-	}  // namespace
-
-	void ReadConfigs()
-	{
-		g_configVec = ConfigUtils::ReadConfigs<MusicTypeParser, Parsers::Statement<ConfigData>>(kTypeName);
-	}
-
-	void Patch()
-	{
-		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
-
-		ConfigUtils::Prepare(g_configVec, Prepare);
-
-		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
-		logger::info("");
-
-		logger::info("======================== Start patching for {} ========================", kTypeName);
-
-		for (const auto& [musicType, patchData] : g_patchMap)
-		{
-			if (patchData.Ducking.has_value())
-			{
-				musicType->ducksOtherMusicBy = patchData.Ducking.value();
-			}
-			if (patchData.FadeDuration.has_value())
-			{
-				musicType->fadeTime = patchData.FadeDuration.value();
-			}
-			if (patchData.Flags.has_value())
-			{
-				musicType->flags = patchData.Flags.value();
-			}
-			if (patchData.MusicTracks.has_value())
-			{
-				PatchMusicTracks(musicType, patchData.MusicTracks.value());
-			}
-			if (patchData.Priority.has_value())
-			{
-				musicType->priority = static_cast<std::int8_t>(patchData.Priority.value());
-			}
-		}
-
-		logger::info("======================== Finished patching for {} ========================", kTypeName);
-		logger::info("");
-
-		g_configVec.clear();
-		g_patchMap.clear();
-	}
-}  // namespace MusicTypes
+#include "MusicTypes.h"
+
+#include <any>
+#include <regex>
+
+#include "ArrayEditor.h"
+#include "ConfigUtils.h"
+#include "Parsers.h"
+#include "PatchTable.h"
+#include "Utils.h"
+
+namespace MusicTypes
+{
+	namespace
+	{
+		constexpr std::string_view kTypeName = "MusicType";
+
+		enum class FilterType
+		{
+			kFormID,
+			kEditorID,
+			kEditorIDPattern
+		};
+
+		std::string_view FilterTypeToString(FilterType a_value)
+		{
+			switch (a_value)
+			{
+			case FilterType::kFormID:
+				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		enum class ElementType
+		{
+			kDucking,
+			kFadeDuration,
+			kFlags,
+			kMusicTracks,
+			kPriority
+		};
+
+		std::string_view ElementTypeToString(ElementType a_value)
+		{
+			switch (a_value)
+			{
+			case ElementType::kDucking:
+				return "Ducking";
+			case ElementType::kFadeDuration:
+				return "FadeDuration";
+			case ElementType::kFlags:
+				return "Flags";
+			case ElementType::kMusicTracks:
+				return "MusicTracks";
+			case ElementType::kPriority:
+				return "Priority";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		enum class OperationType
+		{
+			kClear,
+			kAdd,
+			kDelete
+		};
+
+		std::string_view OperationTypeToString(OperationType a_value)
+		{
+			switch (a_value)
+			{
+			case OperationType::kClear:
+				return "Clear";
+			case OperationType::kAdd:
+				return "Add";
+			case OperationType::kDelete:
+				return "Delete";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		struct ConfigData
+		{
+			struct Operation
+			{
+				OperationType OpType;
+				std::optional<std::string> OpForm;
+			};
+
+			FilterType Filter;
+			std::string FilterForm;
+			ElementType Element;
+			std::vector<Operation> Operations;
+			std::optional<std::any> AssignValue;
+		};
+
+		struct PatchData
+		{
+			struct MusicTracksData
+			{
+				bool Clear = false;
+				std::vector<RE::BGSMusicTrackFormWrapper*> AddTrackVec;
+				std::vector<RE::BGSMusicTrackFormWrapper*> DeleteTrackVec;
+			};
+
+			std::optional<std::uint16_t> Ducking;
+			std::optional<float> FadeDuration;
+			std::optional<std::uint32_t> Flags;
+			std::optional<MusicTracksData> MusicTracks;
+			std::optional<std::uint8_t> Priority;
+		};
+
+		std::vector<Parsers::Statement<ConfigData>> g_configVec;
+		Utils::PatchTable<RE::BGSMusicType, PatchData> g_patchMap;
+
+		class MusicTypeParser : public Parsers::Parser<ConfigData>
+		{
+		public:
+			MusicTypeParser(std::string_view a_configPath) : Parsers::Parser<ConfigData>(a_configPath) {}
+
+		protected:
+			std::optional<Parsers::Statement<ConfigData>> ParseExpressionStatement() override
+			{
+				ConfigData configData{};
+
+				if (!ParseFilter(configData))
+				{
+					return std::nullopt;
+				}
+
+				auto token = reader.GetToken();
+				if (token != ".")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				if (!ParseElement(configData))
+				{
+					return std::nullopt;
+				}
+
+				token = reader.Peek();
+				if (token == "=")
+				{
+					if (!ParseAssignment(configData))
+					{
+						return std::nullopt;
+					}
+				}
+				else
+				{
+					do
+					{
+						token = reader.GetToken();
+						if (token != ".")
+						{
+							logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
+							return std::nullopt;
+						}
+
+						if (!ParseOperation(configData))
+						{
+							return std::nullopt;
+						}
+					} while (reader.Peek() == ".");
+				}
+
+				token = reader.GetToken();
+				if (token != ";")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ';'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				return Parsers::Statement<ConfigData>::CreateExpressionStatement(configData);
+			}
+
+			void PrintExpressionStatement(const ConfigData& a_configData, int a_indent) override
+			{
+				auto indent = std::string(a_indent * 4, ' ');
+
+				switch (a_configData.Element)
+				{
+				case ElementType::kDucking:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
+						static_cast<float>(std::any_cast<std::uint16_t>(a_configData.AssignValue.value())) / 100.0f);
+					break;
+
+				case ElementType::kFadeDuration:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
+						std::any_cast<float>(a_configData.AssignValue.value()));
+					break;
+
+				case ElementType::kFlags:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
+						GetFlags(std::any_cast<std::uint32_t>(a_configData.AssignValue.value())));
+					break;
+
+				case ElementType::kMusicTracks:
+					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
+					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
+					{
+						std::string opLog;
+
+						switch (a_configData.Operations[opIndex].OpType)
+						{
+						case OperationType::kClear:
+							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
+							break;
+
+						case OperationType::kAdd:
+						case OperationType::kDelete:
+							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType), a_configData.Operations[opIndex].OpForm.value());
+							break;
+						}
+
+						if (opIndex == a_configData.Operations.size() - 1)
+						{
+							opLog += ";";
+						}
+
+						logger::info("{}    {}", indent, opLog);
+					}
+					break;
+
+				case ElementType::kPriority:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element),
+						std::any_cast<std::uint8_t>(a_configData.AssignValue.value()));
+					break;
+				}
+			}
+
+			bool ParseFilter(ConfigData& a_configData)
+			{
+				auto token = reader.GetToken();
+				if (token == "FilterByFormID")
+				{
+					a_configData.Filter = FilterType::kFormID;
+				}
+				else if (token == "FilterByEditorID")
+				{
+					a_configData.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_configData.Filter = FilterType::kEditorIDPattern;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				const auto filterFormOpt = ParseFilterForm(a_configData.Filter);
+				if (!filterFormOpt.has_value())
+				{
+					return false;
+				}
+
+				a_configData.FilterForm = filterFormOpt.value();
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseElement(ConfigData& a_configData)
+			{
+				const auto token = reader.GetToken();
+				if (token == "Ducking")
+				{
+					a_configData.Element = ElementType::kDucking;
+				}
+				else if (token == "FadeDuration")
+				{
+					a_configData.Element = ElementType::kFadeDuration;
+				}
+				else if (token == "Flags")
+				{
+					a_configData.Element = ElementType::kFlags;
+				}
+				else if (token == "MusicTracks")
+				{
+					a_configData.Element = ElementType::kMusicTracks;
+				}
+				else if (token == "Priority")
+				{
+					a_configData.Element = ElementType::kPriority;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid ElementName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseAssignment(ConfigData& a_configData)
+			{
+				auto token = reader.GetToken();
+				if (token != "=")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '='.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				if (a_configData.Element == ElementType::kDucking)
+				{
+					const auto parsedValueOpt = ParseNumber<float>();
+					if (!parsedValueOpt.has_value())
+					{
+						return false;
+					}
+
+					if (parsedValueOpt.value() < 0.0f || parsedValueOpt.value() > 655.35f)
+					{
+						logger::warn("Line {}, Col {}: Failed to parse value '{}'. The value is out of range", reader.GetLastLine(), reader.GetLastLineIndex(), parsedValueOpt.value());
+						return false;
+					}
+
+					const auto value = static_cast<std::uint16_t>(std::round(parsedValueOpt.value() * 100.0f));
+					a_configData.AssignValue = std::any(value);
+				}
+				else if (a_configData.Element == ElementType::kFadeDuration)
+				{
+					const auto parsedValueOpt = ParseNumber<float>();
+					if (!parsedValueOpt.has_value())
+					{
+						return false;
+					}
+
+					a_configData.AssignValue = std::any(parsedValueOpt.value());
+				}
+				else if (a_configData.Element == ElementType::kFlags)
+				{
+					std::uint32_t flagValue = 0;
+
+					auto flag = ParseFlag();
+					if (!flag.has_value())
+					{
+						return false;
+					}
+					flagValue |= flag.value();
+
+					while (reader.Peek() == "|")
+					{
+						token = reader.GetToken();
+
+						flag = ParseFlag();
+						if (!flag.has_value())
+						{
+							return false;
+						}
+						flagValue |= flag.value();
+					}
+
+					a_configData.AssignValue = std::any(flagValue);
+				}
+				else if (a_configData.Element == ElementType::kPriority)
+				{
+					const auto priorityOpt = ParseNumber<std::uint8_t>();
+					if (!priorityOpt.has_value())
+					{
+						return false;
+					}
+
+					a_configData.AssignValue = std::any(priorityOpt.value());
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid Assignment for '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element));
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseOperation(ConfigData& a_configData)
+			{
+				ConfigData::Operation newOp{};
+
+				auto token = reader.GetToken();
+				if (token == "Clear")
+				{
+					newOp.OpType = OperationType::kClear;
+				}
+				else if (token == "Add")
+				{
+					newOp.OpType = OperationType::kAdd;
+				}
+				else if (token == "Delete")
+				{
+					newOp.OpType = OperationType::kDelete;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
+					if (elem == ElementType::kMusicTracks)
+					{
+						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
+					}
+					return false;
+				}(a_configData.Element, newOp.OpType);
+
+				if (!isValidOperation)
+				{
+					logger::warn("Line {}, Col {}: Invalid Operation '{}.{}()'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_configData.Element), OperationTypeToString(newOp.OpType));
+					return false;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				switch (a_configData.Element)
+				{
+				case ElementType::kMusicTracks:
+					if (newOp.OpType != OperationType::kClear)
+					{
+						const auto formOpt = ParseForm();
+						if (!formOpt.has_value())
+						{
+							return false;
+						}
+
+						newOp.OpForm = formOpt.value();
+					}
+
+					break;
+				}
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				a_configData.Operations.emplace_back(newOp);
+
+				return true;
+			}
+
+			std::optional<std::uint32_t> ParseFlag()
+			{
+				const auto token = reader.GetToken();
+				if (token.empty())
+				{
+					logger::warn("Line {}, Col {}: Expected flag.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				if (token == "None")
+				{
+					return 0x0000;
+				}
+				else if (token == "PlaysOneSelection")
+				{
+					return 0x0001;
+				}
+				else if (token == "AbruptTransition")
+				{
+					return 0x0002;
+				}
+				else if (token == "CycleTracks")
+				{
+					return 0x0004;
+				}
+				else if (token == "MaintainTrackOrder")
+				{
+					return 0x0008;
+				}
+				else if (token == "DucksCurrentTrack")
+				{
+					return 0x0020;
+				}
+				else if (token == "DoesNotQueue")
+				{
+					return 0x0040;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid flag '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return std::nullopt;
+				}
+			}
+
+			std::string GetFlags(std::uint32_t a_flags)
+			{
+				static constexpr std::string_view kSeparator = " | ";
+
+				std::string flags;
+
+				if (a_flags & 0x0001)
+				{
+					flags += "PlaysOneSelection | ";
+				}
+				if (a_flags & 0x0002)
+				{
+					flags += "AbruptTransition | ";
+				}
+				if (a_flags & 0x0004)
+				{
+					flags += "CycleTracks | ";
+				}
+				if (a_flags & 0x0008)
+				{
+					flags += "MaintainTrackOrder | ";
+				}
+				if (a_flags & 0x0020)
+				{
+					flags += "DucksCurrentTrack | ";
+				}
+				if (a_flags & 0x0040)
+				{
+					flags += "DoesNotQueue | ";
+				}
+
+				if (flags.empty())
+				{
+					return "None";
+				}
+
+				return flags.substr(0, flags.size() - kSeparator.size());
+			}
+		};
+
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
+		{
+			if (a_configData.Element == ElementType::kDucking)
+			{
+				a_patchData.Ducking = std::any_cast<std::uint16_t>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kFadeDuration)
+			{
+				a_patchData.FadeDuration = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kFlags)
+			{
+				a_patchData.Flags = std::any_cast<std::uint32_t>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kMusicTracks)
+			{
+				if (!a_patchData.MusicTracks.has_value())
+				{
+					a_patchData.MusicTracks = PatchData::MusicTracksData{};
+				}
+
+				for (const auto& op : a_configData.Operations)
+				{
+					if (op.OpType == OperationType::kClear)
+					{
+						a_patchData.MusicTracks->Clear = true;
+					}
+					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
+					{
+						auto* opForm = Utils::GetFormFromString(op.OpForm.value());
+						if (!opForm)
+						{
+							logger::warn("Invalid Form: '{}'.", op.OpForm.value());
+							continue;
+						}
+
+						auto* musicTrack = opForm->As<RE::BGSMusicTrackFormWrapper>();
+						if (!musicTrack)
+						{
+							logger::warn("'{}' is not a MusicTrack.", op.OpForm.value());
+							continue;
+						}
+
+						if (op.OpType == OperationType::kAdd)
+						{
+							a_patchData.MusicTracks->AddTrackVec.emplace_back(musicTrack);
+						}
+						else
+						{
+							a_patchData.MusicTracks->DeleteTrackVec.emplace_back(musicTrack);
+						}
+					}
+				}
+			}
+			else if (a_configData.Element == ElementType::kPriority)
+			{
+				a_patchData.Priority = std::any_cast<std::uint8_t>(a_configData.AssignValue.value());
+			}
+		}
+
+		std::vector<RE::BGSMusicType*> GetTargets(const ConfigData& a_configData)
+		{
+			return ConfigUtils::GetFilteredForms<RE::BGSMusicType>(a_configData, "a MusicType");
+		}
+
+		void PatchMusicTracks(RE::BGSMusicType* a_musicType, const PatchData::MusicTracksData& a_musicTracksData)
+		{
+			Utils::ArrayEditor editor(a_musicType->tracks, [](RE::BSIMusicTrack* a_track) { return a_track; });
+
+			// Clear
+			if (a_musicTracksData.Clear)
+			{
+				editor.Clear();
+			}
+			// Delete
+			else
+			{
+				editor.Delete(a_musicTracksData.DeleteTrackVec, [](RE::BSIMusicTrack* a_track) {
+					return RE::fallout_cast<RE::BGSMusicTrackFormWrapper*, RE::BSIMusicTrack>(a_track);
+				});
+			}
+
+			// Add
+			for (const auto& addForm : a_musicTracksData.AddTrackVec)
+			{
+				auto* musicTrack = addForm->As<RE::BSIMusicTrack>();
+				if (musicTrack)
+				{
+					editor.Add(musicTrack);
+				}
+			}
+
+			editor.Commit();
+		}
+	}  // namespace
+
+	void ReadConfigs()
+	{
+		g_configVec = ConfigUtils::ReadConfigs<MusicTypeParser, Parsers::Statement<ConfigData>>(kTypeName);
+	}
+
+	void Patch()
+	{
+		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
+
+		ConfigUtils::Prepare(g_configVec, g_patchMap, GetTargets, PreparePatchData);
+		g_patchMap.Freeze();
+
+		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
+		logger::info("");
+
+		logger::info("======================== Start patching for {} ========================", kTypeName);
+
+		for (const auto& [musicType, patchData] : g_patchMap)
+		{
+			if (patchData.Ducking.has_value())
+			{
+				musicType->ducksOtherMusicBy = patchData.Ducking.value();
+			}
+			if (patchData.FadeDuration.has_value())
+			{
+				musicType->fadeTime = patchData.FadeDuration.value();
+			}
+			if (patchData.Flags.has_value())
+			{
+				musicType->flags = patchData.Flags.value();
+			}
+			if (patchData.MusicTracks.has_value())
+			{
+				PatchMusicTracks(musicType, patchData.MusicTracks.value());
+			}
+			if (patchData.Priority.has_value())
+			{
+				musicType->priority = static_cast<std::int8_t>(patchData.Priority.value());
+			}
+		}
+
+		logger::info("======================== Finished patching for {} ========================", kTypeName);
+		logger::info("");
+
+		g_configVec.clear();
+		g_patchMap.clear();
+	}
+}  // namespace MusicTypes
@@ -1,1479 +1,1826 @@
-#include "NPCs.h"
-
-#include <any>
-#include <regex>
-#include <unordered_set>
-
-#include "ConfigUtils.h"
-#include "Parsers.h"
-#include "Utils.h"
-
-namespace NPCs
-{
-	namespace
-	{
-		constexpr std::string_view kTypeName = "NPC";
-
-		enum class FilterType
-		{
-			kFormID
-		};
-
-		std::string_view FilterTypeToString(FilterType a_value)
-		{
-			switch (a_value)
-			{
-			case FilterType::kFormID:
-				return "FilterByFormID";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		enum class ElementType
-		{
-			kClass,
-			kCombatStyle,
-			kDefaultOutfit,
-			kFullName,
-			kHairColor,
-			kHeadParts,
-			kHeadTexture,
-			kHeightMax,
-			kHeightMin,
-			kIsChargenFacePreset,
-			kMorphs,
-			kRace,
-			kSex,
-			kSkin,
-			kTints,
-			kWeightFat,
-			kWeightMuscular,
-			kWeightThin
-		};
-
-		std::string_view ElementTypeToString(ElementType a_value)
-		{
-			switch (a_value)
-			{
-			case ElementType::kClass:
-				return "Class";
-			case ElementType::kCombatStyle:
-				return "CombatStyle";
-			case ElementType::kDefaultOutfit:
-				return "DefaultOutfit";
-			case ElementType::kFullName:
-				return "FullName";
-			case ElementType::kHairColor:
-				return "HairColor";
-			case ElementType::kHeadParts:
-				return "HeadParts";
-			case ElementType::kHeadTexture:
-				return "HeadTexture";
-			case ElementType::kHeightMax:
-				return "HeightMax";
-			case ElementType::kHeightMin:
-				return "HeightMin";
-			case ElementType::kIsChargenFacePreset:
-				return "IsChargenFacePreset";
-			case ElementType::kMorphs:
-				return "Morphs";
-			case ElementType::kRace:
-				return "Race";
-			case ElementType::kSex:
-				return "Sex";
-			case ElementType::kSkin:
-				return "Skin";
-			case ElementType::kTints:
-				return "Tints";
-			case ElementType::kWeightFat:
-				return "WeightFat";
-			case ElementType::kWeightMuscular:
-				return "WeightMuscular";
-			case ElementType::kWeightThin:
-				return "WeightThin";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		enum class OperationType
-		{
-			kClear,
-			kAdd,
-			kSet,
-			kDelete
-		};
-
-		std::string_view OperationTypeToString(OperationType a_value)
-		{
-			switch (a_value)
-			{
-			case OperationType::kClear:
-				return "Clear";
-			case OperationType::kAdd:
-				return "Add";
-			case OperationType::kSet:
-				return "Set";
-			case OperationType::kDelete:
-				return "Delete";
-			default:
-				return std::string_view{};
-			}
-		}
-
-		struct ConfigData
-		{
-			struct Operation
-			{
-				struct MorphData
-				{
-					std::uint32_t Key;
-					float Value;
-				};
-
-				struct TintData
-				{
-					std::uint16_t Index;
-					std::uint32_t Color;
-					float Alpha;
-				};
-
-				OperationType OpType;
-				std::optional<std::any> OpData;
-			};
-
-			FilterType Filter;
-			std::string FilterForm;
-			ElementType Element;
-			std::optional<std::any> AssignValue;
-			std::vector<Operation> Operations;
-		};
-
-		struct PatchData
-		{
-			struct HeadPartsData
-			{
-				bool Clear;
-				std::vector<RE::BGSHeadPart*> AddPartVec;
-				std::vector<RE::BGSHeadPart*> DeletePartVec;
-			};
-
-			struct MorphsData
-			{
-				bool Clear;
-				std::unordered_map<std::uint32_t, float> SetMorphMap;
-				std::vector<std::uint32_t> DeleteMorphVec;
-			};
-
-			struct TintsData
-			{
-				bool Clear;
-				std::unordered_map<std::uint16_t, std::pair<std::uint32_t, float>> SetTintMap;
-				std::vector<std::uint16_t> DeleteTintVec;
-			};
-
-			std::optional<RE::TESClass*> Class;
-			std::optional<RE::TESCombatStyle*> CombatStyle;
-			std::optional<RE::BGSOutfit*> DefaultOutfit;
-			std::optional<std::string> FullName;
-			std::optional<RE::BGSColorForm*> HairColor;
-			std::optional<HeadPartsData> HeadParts;
-			std::optional<RE::BGSTextureSet*> HeadTexture;
-			std::optional<float> HeightMin;
-			std::optional<float> HeightMax;
-			std::optional<bool> IsChargenFacePreset;
-			std::optional<MorphsData> Morphs;
-			std::optional<RE::TESRace*> Race;
-			std::optional<std::uint8_t> Sex;
-			std::optional<RE::TESObjectARMO*> Skin;
-			std::optional<TintsData> Tints;
-			std::optional<float> WeightFat;
-			std::optional<float> WeightMuscular;
-			std::optional<float> WeightThin;
-		};
-
-		bool g_prepared = false;
-		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::TESNPC*, PatchData> g_patchMap;
-
-		class NPCParser : public Parsers::Parser<ConfigData>
-		{
-		public:
-			NPCParser(std::string_view a_configPath) : Parsers::Parser<ConfigData>(a_configPath) {}
-
-		protected:
-			std::optional<Parsers::Statement<ConfigData>> ParseExpressionStatement() override
-			{
-				ConfigData configData{};
-
-				if (!ParseFilter(configData))
-				{
-					return std::nullopt;
-				}
-
-				auto token = reader.GetToken();
-				if (token != ".")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				if (!ParseElement(configData))
-				{
-					return std::nullopt;
-				}
-
-				token = reader.Peek();
-				if (token == "=")
-				{
-					if (!ParseAssignment(configData))
-					{
-						return std::nullopt;
-					}
-				}
-				else
-				{
-					do
-					{
-						token = reader.GetToken();
-						if (token != ".")
-						{
-							logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
-							return std::nullopt;
-						}
-
-						if (!ParseOperation(configData))
-						{
-							return std::nullopt;
-						}
-					} while (reader.Peek() == ".");
-				}
-
-				token = reader.GetToken();
-				if (token != ";")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ';'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return std::nullopt;
-				}
-
-				return Parsers::Statement<ConfigData>::CreateExpressionStatement(configData);
-			}
-
-			void PrintExpressionStatement(const ConfigData& a_configData, int a_indent) override
-			{
-				auto indent = std::string(a_indent * 4, ' ');
-
-				switch (a_configData.Element)
-				{
-				case ElementType::kHeadParts:
-					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
-					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
-					{
-						std::string opLog;
-
-						switch (a_configData.Operations[opIndex].OpType)
-						{
-						case OperationType::kClear:
-							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
-							break;
-
-						case OperationType::kAdd:
-						case OperationType::kDelete:
-							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<std::string>(a_configData.Operations[opIndex].OpData.value()));
-							break;
-						}
-
-						if (opIndex == a_configData.Operations.size() - 1)
-						{
-							opLog += ";";
-						}
-
-						logger::info("{}    {}", indent, opLog);
-					}
-					break;
-
-				case ElementType::kMorphs:
-					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
-					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
-					{
-						std::string opLog;
-
-						switch (a_configData.Operations[opIndex].OpType)
-						{
-						case OperationType::kClear:
-							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
-							break;
-
-						case OperationType::kSet:
-							opLog = fmt::format(".{}({:08X}, {})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<ConfigData::Operation::MorphData>(a_configData.Operations[opIndex].OpData.value()).Key,
-								std::any_cast<ConfigData::Operation::MorphData>(a_configData.Operations[opIndex].OpData.value()).Value);
-							break;
-
-						case OperationType::kDelete:
-							opLog = fmt::format(".{}({:08X})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<ConfigData::Operation::MorphData>(a_configData.Operations[opIndex].OpData.value()).Key);
-							break;
-						}
-
-						if (opIndex == a_configData.Operations.size() - 1)
-						{
-							opLog += ";";
-						}
-
-						logger::info("{}    {}", indent, opLog);
-					}
-					break;
-
-				case ElementType::kTints:
-					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
-					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
-					{
-						std::string opLog;
-
-						switch (a_configData.Operations[opIndex].OpType)
-						{
-						case OperationType::kClear:
-							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
-							break;
-
-						case OperationType::kSet:
-							opLog = fmt::format(".{}({}, {}, {}, {}, {})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Index,
-								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Color & static_cast<std::uint32_t>(UINT8_MAX),
-								(std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Color >> 8) & static_cast<std::uint32_t>(UINT8_MAX),
-								(std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Color >> 16) & static_cast<std::uint32_t>(UINT8_MAX),
-								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Alpha);
-							break;
-
-						case OperationType::kDelete:
-							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
-								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Index);
-							break;
-						}
-
-						if (opIndex == a_configData.Operations.size() - 1)
-						{
-							opLog += ";";
-						}
-
-						logger::info("{}    {}", indent, opLog);
-					}
-					break;
-
-				case ElementType::kHeightMax:
-				case ElementType::kHeightMin:
-				case ElementType::kWeightFat:
-				case ElementType::kWeightMuscular:
-				case ElementType::kWeightThin:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
-						ElementTypeToString(a_configData.Element), std::any_cast<float>(a_configData.AssignValue.value()));
-					break;
-
-				case ElementType::kClass:
-				case ElementType::kCombatStyle:
-				case ElementType::kDefaultOutfit:
-				case ElementType::kHairColor:
-				case ElementType::kHeadTexture:
-				case ElementType::kRace:
-				case ElementType::kSkin:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
-						ElementTypeToString(a_configData.Element), std::any_cast<std::string>(a_configData.AssignValue.value()));
-					break;
-
-				case ElementType::kFullName:
-					logger::info("{}{}({}).{} = \"{}\";", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
-						ElementTypeToString(a_configData.Element), std::any_cast<std::string>(a_configData.AssignValue.value()));
-					break;
-
-				case ElementType::kIsChargenFacePreset:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
-						ElementTypeToString(a_configData.Element), std::any_cast<bool>(a_configData.AssignValue.value()));
-					break;
-
-				case ElementType::kSex:
-					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
-						ElementTypeToString(a_configData.Element), std::any_cast<std::uint8_t>(a_configData.AssignValue.value()));
-					break;
-				}
-			}
-
-			bool ParseFilter(ConfigData& a_config)
-			{
-				auto token = reader.GetToken();
-				if (token == "FilterByFormID")
-				{
-					a_config.Filter = FilterType::kFormID;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				token = reader.GetToken();
-				if (token != "(")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				const auto filterFormOpt = ParseForm();
-				if (!filterFormOpt.has_value())
-				{
-					return false;
-				}
-
-				a_config.FilterForm = filterFormOpt.value();
-
-				token = reader.GetToken();
-				if (token != ")")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseElement(ConfigData& a_config)
-			{
-				const auto token = reader.GetToken();
-				if (token == "Class")
-				{
-					a_config.Element = ElementType::kClass;
-				}
-				else if (token == "CombatStyle")
-				{
-					a_config.Element = ElementType::kCombatStyle;
-				}
-				else if (token == "DefaultOutfit")
-				{
-					a_config.Element = ElementType::kDefaultOutfit;
-				}
-				else if (token == "FullName")
-				{
-					a_config.Element = ElementType::kFullName;
-				}
-				else if (token == "HairColor")
-				{
-					a_config.Element = ElementType::kHairColor;
-				}
-				else if (token == "HeadParts")
-				{
-					a_config.Element = ElementType::kHeadParts;
-				}
-				else if (token == "HeadTexture")
-				{
-					a_config.Element = ElementType::kHeadTexture;
-				}
-				else if (token == "HeightMax")
-				{
-					a_config.Element = ElementType::kHeightMax;
-				}
-				else if (token == "HeightMin")
-				{
-					a_config.Element = ElementType::kHeightMin;
-				}
-				else if (token == "IsChargenFacePreset")
-				{
-					a_config.Element = ElementType::kIsChargenFacePreset;
-				}
-				else if (token == "Morphs")
-				{
-					a_config.Element = ElementType::kMorphs;
-				}
-				else if (token == "Race")
-				{
-					a_config.Element = ElementType::kRace;
-				}
-				else if (token == "Sex")
-				{
-					a_config.Element = ElementType::kSex;
-				}
-				else if (token == "Skin")
-				{
-					a_config.Element = ElementType::kSkin;
-				}
-				else if (token == "Tints")
-				{
-					a_config.Element = ElementType::kTints;
-				}
-				else if (token == "WeightFat")
-				{
-					a_config.Element = ElementType::kWeightFat;
-				}
-				else if (token == "WeightMuscular")
-				{
-					a_config.Element = ElementType::kWeightMuscular;
-				}
-				else if (token == "WeightThin")
-				{
-					a_config.Element = ElementType::kWeightThin;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid ElementName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseAssignment(ConfigData& a_config)
-			{
-				auto token = reader.GetToken();
-				if (token != "=")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '='.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				if (a_config.Element == ElementType::kClass || a_config.Element == ElementType::kCombatStyle || a_config.Element == ElementType::kDefaultOutfit ||
-					a_config.Element == ElementType::kHairColor || a_config.Element == ElementType::kHeadTexture || a_config.Element == ElementType::kRace || a_config.Element == ElementType::kSkin)
-				{
-					token = reader.Peek();
-					if (token == "null")
-					{
-						a_config.AssignValue = std::any(std::string(reader.GetToken()));
-						return true;
-					}
-
-					const auto formOpt = ParseForm();
-					if (!formOpt.has_value())
-					{
-						return false;
-					}
-
-					a_config.AssignValue = std::any(formOpt.value());
-				}
-				else if (a_config.Element == ElementType::kFullName)
-				{
-					const auto fullNameOpt = ParseString();
-					if (!fullNameOpt.has_value())
-					{
-						return false;
-					}
-
-					a_config.AssignValue = std::any(fullNameOpt.value());
-				}
-				else if (a_config.Element == ElementType::kHeightMax || a_config.Element == ElementType::kHeightMin ||
-						 a_config.Element == ElementType::kWeightFat || a_config.Element == ElementType::kWeightMuscular || a_config.Element == ElementType::kWeightThin)
-				{
-					const auto valueOpt = ParseNumber<float>();
-					if (!valueOpt.has_value())
-					{
-						return false;
-					}
-
-					a_config.AssignValue = std::any(valueOpt.value());
-				}
-				else if (a_config.Element == ElementType::kIsChargenFacePreset)
-				{
-					token = reader.GetToken();
-					if (token == "true")
-					{
-						a_config.AssignValue = std::any(true);
-					}
-					else if (token == "false")
-					{
-						a_config.AssignValue = std::any(false);
-					}
-					else
-					{
-						logger::warn("Line {}, Col {}: Invalid value '{}'. For IsChargenFacePreset, the value must be 'true' or 'false'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-						return false;
-					}
-				}
-				else if (a_config.Element == ElementType::kSex)
-				{
-					const auto sexOpt = ParseNumber<std::uint8_t>();
-					if (!sexOpt.has_value())
-					{
-						return false;
-					}
-
-					if (sexOpt.value() != 0 && sexOpt.value() != 1)
-					{
-						logger::warn("Line {}, Col {}: Invalid value '{}'. For Sex, the value must be 0 or 1.", reader.GetLastLine(), reader.GetLastLineIndex(), sexOpt.value());
-						return false;
-					}
-
-					a_config.AssignValue = std::any(sexOpt.value());
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid Assignment for '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_config.Element));
-					return false;
-				}
-
-				return true;
-			}
-
-			bool ParseOperation(ConfigData& a_config)
-			{
-				ConfigData::Operation newOp{};
-
-				auto token = reader.GetToken();
-				if (token == "Clear")
-				{
-					newOp.OpType = OperationType::kClear;
-				}
-				else if (token == "Add")
-				{
-					newOp.OpType = OperationType::kAdd;
-				}
-				else if (token == "Set")
-				{
-					newOp.OpType = OperationType::kSet;
-				}
-				else if (token == "Delete")
-				{
-					newOp.OpType = OperationType::kDelete;
-				}
-				else
-				{
-					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-					return false;
-				}
-
-				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
-					switch (elem)
-					{
-					case ElementType::kHeadParts:
-						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
-					case ElementType::kMorphs:
-					case ElementType::kTints:
-						return op == OperationType::kClear || op == OperationType::kSet || op == OperationType::kDelete;
-					default:
-						return false;
-					}
-				}(a_config.Element, newOp.OpType);
-
-				if (!isValidOperation)
-				{
-					logger::warn("Line {}, Col {}: Invalid Operation '{}.{}()'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_config.Element), OperationTypeToString(newOp.OpType));
-					return false;
-				}
-
-				token = reader.GetToken();
-				if (token != "(")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				switch (a_config.Element)
-				{
-				case ElementType::kHeadParts:
-					if (newOp.OpType != OperationType::kClear)
-					{
-						const auto formOpt = ParseForm();
-						if (!formOpt.has_value())
-						{
-							return false;
-						}
-
-						newOp.OpData = std::any(formOpt.value());
-					}
-
-					break;
-
-				case ElementType::kMorphs:
-					if (newOp.OpType != OperationType::kClear)
-					{
-						ConfigData::Operation::MorphData morphData{};
-
-						token = reader.GetToken();
-						if (!IsHexString(token))
-						{
-							logger::warn("Line {}, Col {}: Expected morphKey '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-							return false;
-						}
-
-						const auto morphKeyOpt = Utils::ParseHex(token);
-						if (!morphKeyOpt.has_value())
-						{
-							logger::warn("Line {}, Col {}: Failed to parse morphKey '{}'. The value must be a hexadecimal number.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
-							return false;
-						}
-
-						morphData.Key = morphKeyOpt.value();
-
-						if (newOp.OpType == OperationType::kSet)
-						{
-							token = reader.GetToken();
-							if (token != ",")
-							{
-								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
-								return false;
-							}
-
-							const auto morphValueOpt = ParseNumber<float>();
-							if (!morphValueOpt.has_value())
-							{
-								return false;
-							}
-
-							if (morphValueOpt.value() < 0.0f || morphValueOpt.value() > 1.0f)
-							{
-								logger::warn("Line {}, Col {}: Invalid morphValue '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), morphValueOpt.value());
-								return false;
-							}
-
-							morphData.Value = morphValueOpt.value();
-						}
-
-						newOp.OpData = std::any(morphData);
-					}
-
-					break;
-
-				case ElementType::kTints:
-					if (newOp.OpType != OperationType::kClear)
-					{
-						ConfigData::Operation::TintData tintData{};
-
-						const auto indexOpt = ParseNumber<std::uint16_t>();
-						if (!indexOpt.has_value())
-						{
-							return false;
-						}
-						tintData.Index = indexOpt.value();
-
-						if (newOp.OpType == OperationType::kSet)
-						{
-							token = reader.GetToken();
-							if (token != ",")
-							{
-								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
-								return false;
-							}
-
-							const auto tintColorRedOpt = ParseNumber<std::uint8_t>();
-							if (!tintColorRedOpt.has_value())
-							{
-								return false;
-							}
-
-							std::uint32_t tintColor = tintColorRedOpt.value();
-
-							token = reader.GetToken();
-							if (token != ",")
-							{
-								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
-								return false;
-							}
-
-							const auto tintColorGreenOpt = ParseNumber<std::uint8_t>();
-							if (!tintColorGreenOpt.has_value())
-							{
-								return false;
-							}
-
-							tintColor |= tintColorGreenOpt.value() << 8;
-
-							token = reader.GetToken();
-							if (token != ",")
-							{
-								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
-								return false;
-							}
-
-							const auto tintColorBlueOpt = ParseNumber<std::uint8_t>();
-							if (!tintColorBlueOpt.has_value())
-							{
-								return false;
-							}
-
-							tintColor |= tintColorBlueOpt.value() << 16;
-							tintData.Color = tintColor;
-
-							token = reader.GetToken();
-							if (token != ",")
-							{
-								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
-								return false;
-							}
-
-							const auto tintAlphaOpt = ParseNumber<float>();
-							if (!tintAlphaOpt.has_value())
-							{
-								return false;
-							}
-
-							if (tintAlphaOpt.value() < 0.0f || tintAlphaOpt.value() > 1.0f)
-							{
-								logger::warn("Line {}, Col {}: Invalid tintAlpha '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), tintAlphaOpt.value());
-								return false;
-							}
-
-							tintData.Alpha = tintAlphaOpt.value();
-						}
-
-						newOp.OpData = std::any(tintData);
-					}
-
-					break;
-				}
-
-				token = reader.GetToken();
-				if (token != ")")
-				{
-					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
-					return false;
-				}
-
-				a_config.Operations.emplace_back(newOp);
-
-				return true;
-			}
-		};
-
-		void Prepare(const ConfigData& a_configData)
-		{
-			if (a_configData.Filter == FilterType::kFormID)
-			{
-				auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-				if (!filterForm)
-				{
-					logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-					return;
-				}
-
-				auto* npc = filterForm->As<RE::TESNPC>();
-				if (!npc)
-				{
-					logger::warn("'{}' is not a NPC.", a_configData.FilterForm);
-					return;
-				}
-
-				auto& patchData = g_patchMap[npc];
-
-				if (a_configData.Element == ElementType::kClass)
-				{
-					const auto classFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (classFormStr == "null")
-					{
-						patchData.Class = nullptr;
-					}
-					else
-					{
-						auto* classForm = Utils::GetFormFromString(classFormStr);
-						if (!classForm)
-						{
-							logger::warn("Invalid Form: '{}'.", classFormStr);
-							return;
-						}
-
-						auto* class_ = classForm->As<RE::TESClass>();
-						if (!class_)
-						{
-							logger::warn("'{}' is not a Class.", classFormStr);
-							return;
-						}
-
-						patchData.Class = class_;
-					}
-				}
-				else if (a_configData.Element == ElementType::kCombatStyle)
-				{
-					const auto combatStyleFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (combatStyleFormStr == "null")
-					{
-						patchData.CombatStyle = nullptr;
-					}
-					else
-					{
-						auto* combatStyleForm = Utils::GetFormFromString(combatStyleFormStr);
-						if (!combatStyleForm)
-						{
-							logger::warn("Invalid Form: '{}'.", combatStyleFormStr);
-							return;
-						}
-
-						auto* combatStyle = combatStyleForm->As<RE::TESCombatStyle>();
-						if (!combatStyle)
-						{
-							logger::warn("'{}' is not a CombatStyle.", combatStyleFormStr);
-							return;
-						}
-
-						patchData.CombatStyle = combatStyle;
-					}
-				}
-				else if (a_configData.Element == ElementType::kDefaultOutfit)
-				{
-					const auto outfitFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (outfitFormStr == "null")
-					{
-						patchData.DefaultOutfit = nullptr;
-					}
-					else
-					{
-						auto* outfitForm = Utils::GetFormFromString(outfitFormStr);
-						if (!outfitForm)
-						{
-							logger::warn("Invalid Form: '{}'.", outfitFormStr);
-							return;
-						}
-
-						auto* outfit = outfitForm->As<RE::BGSOutfit>();
-						if (!outfit)
-						{
-							logger::warn("'{}' is not a Outfit.", outfitFormStr);
-							return;
-						}
-
-						patchData.DefaultOutfit = outfit;
-					}
-				}
-				else if (a_configData.Element == ElementType::kFullName)
-				{
-					patchData.FullName = std::any_cast<std::string>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kHairColor)
-				{
-					const auto colorFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (colorFormStr == "null")
-					{
-						patchData.HairColor = nullptr;
-					}
-					else
-					{
-						auto* colorForm = Utils::GetFormFromString(colorFormStr);
-						if (!colorForm)
-						{
-							logger::warn("Invalid Form: '{}'.", colorFormStr);
-							return;
-						}
-
-						auto* color = colorForm->As<RE::BGSColorForm>();
-						if (!color)
-						{
-							logger::warn("'{}' is not a Color.", colorFormStr);
-							return;
-						}
-
-						patchData.HairColor = color;
-					}
-				}
-				else if (a_configData.Element == ElementType::kHeadParts)
-				{
-					if (!patchData.HeadParts.has_value())
-					{
-						patchData.HeadParts = PatchData::HeadPartsData{};
-					}
-
-					for (const auto& op : a_configData.Operations)
-					{
-						if (op.OpType == OperationType::kClear)
-						{
-							patchData.HeadParts->Clear = true;
-						}
-						else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
-						{
-							const auto opFormStr = std::any_cast<std::string>(op.OpData.value());
-
-							auto* opForm = Utils::GetFormFromString(opFormStr);
-							if (!opForm)
-							{
-								logger::warn("Invalid Form: '{}'.", opFormStr);
-								continue;
-							}
-
-							auto* headPart = opForm->As<RE::BGSHeadPart>();
-							if (!headPart)
-							{
-								logger::warn("'{}' is not a HeadPart.", opFormStr);
-								continue;
-							}
-
-							if (op.OpType == OperationType::kAdd)
-							{
-								patchData.HeadParts->AddPartVec.emplace_back(headPart);
-							}
-							else
-							{
-								patchData.HeadParts->DeletePartVec.emplace_back(headPart);
-							}
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kHeadTexture)
-				{
-					const auto texFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (texFormStr == "null")
-					{
-						patchData.HeadTexture = nullptr;
-					}
-					else
-					{
-						auto* texForm = Utils::GetFormFromString(texFormStr);
-						if (!texForm)
-						{
-							logger::warn("Invalid Form: '{}'.", texFormStr);
-							return;
-						}
-
-						auto* textureSet = texForm->As<RE::BGSTextureSet>();
-						if (!textureSet)
-						{
-							logger::warn("'{}' is not a TextureSet.", texFormStr);
-							return;
-						}
-
-						patchData.HeadTexture = textureSet;
-					}
-				}
-				else if (a_configData.Element == ElementType::kHeightMax)
-				{
-					patchData.HeightMax = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kHeightMin)
-				{
-					patchData.HeightMin = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kIsChargenFacePreset)
-				{
-					patchData.IsChargenFacePreset = std::any_cast<bool>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kMorphs)
-				{
-					if (!patchData.Morphs.has_value())
-					{
-						patchData.Morphs = PatchData::MorphsData{};
-					}
-
-					for (const auto& op : a_configData.Operations)
-					{
-						if (op.OpType == OperationType::kClear)
-						{
-							patchData.Morphs->Clear = true;
-						}
-						else if (op.OpType == OperationType::kSet || op.OpType == OperationType::kDelete)
-						{
-							const auto morphData = std::any_cast<ConfigData::Operation::MorphData>(op.OpData.value());
-
-							if (op.OpType == OperationType::kSet)
-							{
-								patchData.Morphs->SetMorphMap.insert(std::make_pair(morphData.Key, morphData.Value));
-							}
-							else
-							{
-								patchData.Morphs->DeleteMorphVec.emplace_back(morphData.Key);
-							}
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kRace)
-				{
-					const auto raceFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (raceFormStr == "null")
-					{
-						patchData.Race = nullptr;
-					}
-					else
-					{
-						auto* raceForm = Utils::GetFormFromString(raceFormStr);
-						if (!raceForm)
-						{
-							logger::warn("Invalid Form: '{}'.", raceFormStr);
-							return;
-						}
-
-						auto* race = raceForm->As<RE::TESRace>();
-						if (!race)
-						{
-							logger::warn("'{}' is not a Race.", raceFormStr);
-							return;
-						}
-
-						patchData.Race = race;
-					}
-				}
-				else if (a_configData.Element == ElementType::kSex)
-				{
-					patchData.Sex = std::any_cast<std::uint8_t>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kSkin)
-				{
-					const auto armoFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
-
-					if (armoFormStr == "null")
-					{
-						patchData.Skin = nullptr;
-					}
-					else
-					{
-						auto* armoForm = Utils::GetFormFromString(armoFormStr);
-						if (!armoForm)
-						{
-							logger::warn("Invalid Form: '{}'.", armoFormStr);
-							return;
-						}
-
-						auto* armo = armoForm->As<RE::TESObjectARMO>();
-						if (!armo)
-						{
-							logger::warn("'{}' is not a Armor.", armoFormStr);
-							return;
-						}
-
-						patchData.Skin = armo;
-					}
-				}
-				else if (a_configData.Element == ElementType::kTints)
-				{
-					if (!patchData.Tints.has_value())
-					{
-						patchData.Tints = PatchData::TintsData{};
-					}
-
-					for (const auto& op : a_configData.Operations)
-					{
-						if (op.OpType == OperationType::kClear)
-						{
-							patchData.Tints->Clear = true;
-						}
-						else if (op.OpType == OperationType::kSet || op.OpType == OperationType::kDelete)
-						{
-							const auto tintData = std::any_cast<ConfigData::Operation::TintData>(op.OpData.value());
-
-							if (op.OpType == OperationType::kSet)
-							{
-								patchData.Tints->SetTintMap.insert(std::make_pair(tintData.Index, std::make_pair(tintData.Color, tintData.Alpha)));
-							}
-							else
-							{
-								patchData.Tints->DeleteTintVec.emplace_back(tintData.Index);
-							}
-						}
-					}
-				}
-				else if (a_configData.Element == ElementType::kWeightFat)
-				{
-					patchData.WeightFat = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kWeightMuscular)
-				{
-					patchData.WeightMuscular = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-				else if (a_configData.Element == ElementType::kWeightThin)
-				{
-					patchData.WeightThin = std::any_cast<float>(a_configData.AssignValue.value());
-				}
-			}
-		}
-
-		void PrepareOnce()
-		{
-			if (g_prepared)
-			{
-				return;
-			}
-
-			logger::info("======================== Start preparing patch for {} ========================", kTypeName);
-
-			ConfigUtils::Prepare(g_configVec, Prepare);
-			g_prepared = true;
-
-			logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
-			logger::info("");
-		}
-
-		void AddHeadPart(RE::TESNPC* a_npc, RE::BGSHeadPart* a_hdpt)
-		{
-			using func_t = void (*)(RE::TESNPC*, RE::BGSHeadPart*, std::uint32_t, std::uint32_t);
-			const REL::Relocation<func_t> func{ REL::ID(735660) };
-			func(a_npc, a_hdpt, 1, false);
-		}
-
-		void RemoveHeadPart(RE::TESNPC* a_npc, RE::BGSHeadPart* a_hdpt)
-		{
-			using func_t = void (*)(RE::TESNPC*, RE::BGSHeadPart*, bool);
-			const REL::Relocation<func_t> func{ REL::ID(880456) };
-			func(a_npc, a_hdpt, true);
-		}
-
-		void ClearHeadParts(RE::TESNPC* a_npc)
-		{
-			if (a_npc->headParts)
-			{
-				RE::free(a_npc->headParts);
-			}
-			a_npc->headParts = nullptr;
-			a_npc->numHeadParts = 0;
-		}
-
-		void PatchHeadParts(RE::TESNPC* a_npc, const PatchData::HeadPartsData& a_headPartsData)
-		{
-			bool cleared = false;
-
-			// Clear
-			if (a_headPartsData.Clear)
-			{
-				ClearHeadParts(a_npc);
-				cleared = true;
-			}
-
-			// Delete
-			if (!cleared)
-			{
-				for (const auto& delPart : a_headPartsData.DeletePartVec)
-				{
-					RemoveHeadPart(a_npc, delPart);
-				}
-			}
-
-			// Add
-			for (const auto& addPart : a_headPartsData.AddPartVec)
-			{
-				AddHeadPart(a_npc, addPart);
-			}
-		}
-
-		void SetMorphSliderValue(RE::TESNPC* a_npc, std::uint32_t a_morphKey, float a_morphValue)
-		{
-			using func_t = decltype(&SetMorphSliderValue);
-			const REL::Relocation<func_t> func{ REL::ID(1432151) };
-			func(a_npc, a_morphKey, a_morphValue);
-		}
-
-		void PatchMorphs(RE::TESNPC* a_npc, const PatchData::MorphsData& a_morphsData)
-		{
-			if (a_morphsData.Clear)
-			{
-				if (a_npc->morphSliderValues)
-				{
-					a_npc->morphSliderValues->clear();
-				}
-			}
-
-			// Delete
-			if (a_npc->morphSliderValues)
-			{
-				for (auto deleteKey : a_morphsData.DeleteMorphVec)
-				{
-					SetMorphSliderValue(a_npc, deleteKey, 0);
-				}
-			}
-
-			// Set
-			for (auto setPair : a_morphsData.SetMorphMap)
-			{
-				SetMorphSliderValue(a_npc, setPair.first, setPair.second);
-			}
-		}
-
-		void SetTintingData(RE::TESNPC* a_npc, std::uint16_t a_index, float a_value, std::uint32_t a_color)
-		{
-			using func_t = decltype(&SetTintingData);
-			const REL::Relocation<func_t> func{ REL::ID(452734) };
-			func(a_npc, a_index, a_value, a_color);
-		}
-
-		void PatchTints(RE::TESNPC* a_npc, const PatchData::TintsData& a_tintsData)
-		{
-			auto tintingData = reinterpret_cast<RE::BSTArray<RE::BGSCharacterTint::Entries*>*>(a_npc->tintingData);
-
-			if (a_tintsData.Clear)
-			{
-				if (tintingData)
-				{
-					tintingData->clear();
-				}
-			}
-
-			// Delete
-			if (tintingData)
-			{
-				for (auto deleteIndex : a_tintsData.DeleteTintVec)
-				{
-					SetTintingData(a_npc, deleteIndex, 0, UINT32_MAX);
-				}
-			}
-
-			// Set
-			for (auto setPair : a_tintsData.SetTintMap)
-			{
-				SetTintingData(a_npc, setPair.first, setPair.second.second, setPair.second.first);
-			}
-		}
-
-		template <std::uint64_t id, std::ptrdiff_t diff>
-		class TESNPC_ClearStaticDataHook
-		{
-		public:
-			static void Install()
-			{
-				REL::Relocation<std::uintptr_t> target(REL::ID(id), diff);
-				func = *(func_t*)(target.get());
-				REL::safe_write(target.get(), (std::uintptr_t)ProcessHook);
-			}
-
-		private:
-			using func_t = void (*)(RE::TESNPC&);
-
-			static void Patch_PreFunc(RE::TESNPC* a_npc, const PatchData& a_patchData)
-			{
-				if (a_patchData.FullName.has_value())
-				{
-					a_npc->fullName = a_patchData.FullName.value();
-				}
-
-				if (a_patchData.HeightMax.has_value())
-				{
-					a_npc->heightMax = a_patchData.HeightMax.value();
-				}
-
-				if (a_patchData.HeightMin.has_value())
-				{
-					a_npc->height = a_patchData.HeightMin.value();
-				}
-
-				if (a_patchData.IsChargenFacePreset.has_value())
-				{
-					if (a_patchData.IsChargenFacePreset.value())
-					{
-						a_npc->actorData.actorBaseFlags |= RE::ACTOR_BASE_DATA::Flag::kIsChargenFacePreset;
-					}
-					else
-					{
-						if (a_npc->actorData.actorBaseFlags & RE::ACTOR_BASE_DATA::Flag::kIsChargenFacePreset)
-						{
-							a_npc->actorData.actorBaseFlags -= RE::ACTOR_BASE_DATA::Flag::kIsChargenFacePreset;
-						}
-					}
-				}
-
-				if (a_patchData.Race.has_value())
-				{
-					a_npc->formRace = a_patchData.Race.value();
-				}
-
-				if (a_patchData.Sex.has_value())
-				{
-					if (a_patchData.Sex.value())
-					{
-						// Female
-						a_npc->actorData.actorBaseFlags |= RE::ACTOR_BASE_DATA::Flag::kFemale;
-					}
-					else
-					{
-						// Male
-						if (a_npc->actorData.actorBaseFlags & RE::ACTOR_BASE_DATA::Flag::kFemale)
-						{
-							a_npc->actorData.actorBaseFlags -= RE::ACTOR_BASE_DATA::Flag::kFemale;
-						}
-					}
-				}
-
-				if (a_patchData.Skin.has_value())
-				{
-					a_npc->formSkin = a_patchData.Skin.value();
-				}
-
-				if (a_patchData.WeightFat.has_value())
-				{
-					a_npc->morphWeight.z = a_patchData.WeightFat.value();
-				}
-
-				if (a_patchData.WeightMuscular.has_value())
-				{
-					a_npc->morphWeight.y = a_patchData.WeightMuscular.value();
-				}
-
-				if (a_patchData.WeightThin.has_value())
-				{
-					a_npc->morphWeight.x = a_patchData.WeightThin.value();
-				}
-			}
-
-			static void Patch_PostFunc(RE::TESNPC* a_npc, const PatchData& a_patchData)
-			{
-				if (a_patchData.Class.has_value())
-				{
-					a_npc->cl = a_patchData.Class.value();
-				}
-
-				if (a_patchData.CombatStyle.has_value())
-				{
-					a_npc->combatStyle = a_patchData.CombatStyle.value();
-				}
-
-				if (a_patchData.DefaultOutfit.has_value())
-				{
-					a_npc->defOutfit = a_patchData.DefaultOutfit.value();
-				}
-
-				if (a_patchData.HairColor.has_value())
-				{
-					if (a_npc->headRelatedData)
-					{
-						a_npc->headRelatedData->hairColor = a_patchData.HairColor.value();
-					}
-				}
-
-				if (a_patchData.HeadTexture.has_value())
-				{
-					if (a_npc->headRelatedData)
-					{
-						a_npc->headRelatedData->faceDetails = a_patchData.HeadTexture.value();
-					}
-				}
-
-				if (a_patchData.HeadParts.has_value())
-				{
-					PatchHeadParts(a_npc, a_patchData.HeadParts.value());
-				}
-
-				if (a_patchData.Morphs.has_value())
-				{
-					PatchMorphs(a_npc, a_patchData.Morphs.value());
-				}
-
-				if (a_patchData.Tints.has_value())
-				{
-					PatchTints(a_npc, a_patchData.Tints.value());
-				}
-			}
-
-			static void ProcessHook(RE::TESNPC& a_npc)
-			{
-				PrepareOnce();
-
-				const auto it = g_patchMap.find(&a_npc);
-				if (it == g_patchMap.end())
-				{
-					func(a_npc);
-					return;
-				}
-
-				Patch_PreFunc(it->first, it->second);
-				func(a_npc);
-				Patch_PostFunc(it->first, it->second);
-			}
-
-			inline static func_t func;
-		};
-	}  // namespace
-
-	void ReadConfigs()
-	{
-		g_configVec = ConfigUtils::ReadConfigs<NPCParser, Parsers::Statement<ConfigData>>(kTypeName);
-	}
-
-	void Install()
-	{
-		TESNPC_ClearStaticDataHook<1261646, 0xB0>::Install();
-	}
-}  // namespace NPCs
+#include "NPCs.h"
+
+#include <any>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <ranges>
+#include <regex>
+#include <span>
+#include <unordered_set>
+
+#include "ConfigUtils.h"
+#include "Parsers.h"
+#include "PatchTable.h"
+#include "Utils.h"
+
+namespace NPCs
+{
+	namespace
+	{
+		constexpr std::string_view kTypeName = "NPC";
+
+		enum class FilterType
+		{
+			kFormID,
+			kEditorID,
+			kEditorIDPattern,
+			kKeyword,
+			kPredicates
+		};
+
+		std::string_view FilterTypeToString(FilterType a_value)
+		{
+			switch (a_value)
+			{
+			case FilterType::kFormID:
+				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
+			case FilterType::kKeyword:
+				return "FilterByKeyword";
+			case FilterType::kPredicates:
+				return "FilterByPredicates";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		enum class ElementType
+		{
+			kClass,
+			kCombatStyle,
+			kDefaultOutfit,
+			kFullName,
+			kHairColor,
+			kHeadParts,
+			kHeadTexture,
+			kHeightMax,
+			kHeightMin,
+			kIsChargenFacePreset,
+			kMorphs,
+			kRace,
+			kSex,
+			kSkin,
+			kTints,
+			kWeightFat,
+			kWeightMuscular,
+			kWeightThin
+		};
+
+		std::string_view ElementTypeToString(ElementType a_value)
+		{
+			switch (a_value)
+			{
+			case ElementType::kClass:
+				return "Class";
+			case ElementType::kCombatStyle:
+				return "CombatStyle";
+			case ElementType::kDefaultOutfit:
+				return "DefaultOutfit";
+			case ElementType::kFullName:
+				return "FullName";
+			case ElementType::kHairColor:
+				return "HairColor";
+			case ElementType::kHeadParts:
+				return "HeadParts";
+			case ElementType::kHeadTexture:
+				return "HeadTexture";
+			case ElementType::kHeightMax:
+				return "HeightMax";
+			case ElementType::kHeightMin:
+				return "HeightMin";
+			case ElementType::kIsChargenFacePreset:
+				return "IsChargenFacePreset";
+			case ElementType::kMorphs:
+				return "Morphs";
+			case ElementType::kRace:
+				return "Race";
+			case ElementType::kSex:
+				return "Sex";
+			case ElementType::kSkin:
+				return "Skin";
+			case ElementType::kTints:
+				return "Tints";
+			case ElementType::kWeightFat:
+				return "WeightFat";
+			case ElementType::kWeightMuscular:
+				return "WeightMuscular";
+			case ElementType::kWeightThin:
+				return "WeightThin";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		enum class OperationType
+		{
+			kClear,
+			kAdd,
+			kSet,
+			kDelete
+		};
+
+		std::string_view OperationTypeToString(OperationType a_value)
+		{
+			switch (a_value)
+			{
+			case OperationType::kClear:
+				return "Clear";
+			case OperationType::kAdd:
+				return "Add";
+			case OperationType::kSet:
+				return "Set";
+			case OperationType::kDelete:
+				return "Delete";
+			default:
+				return std::string_view{};
+			}
+		}
+
+		struct ConfigData
+		{
+			struct Operation
+			{
+				struct MorphData
+				{
+					std::uint32_t Key;
+					float Value;
+				};
+
+				struct TintData
+				{
+					std::uint16_t Index;
+					std::uint32_t Color;
+					float Alpha;
+				};
+
+				OperationType OpType;
+				std::optional<std::any> OpData;
+			};
+
+			FilterType Filter;
+			std::string FilterForm;
+			ElementType Element;
+			std::optional<std::any> AssignValue;
+			std::vector<Operation> Operations;
+		};
+
+		struct PatchData
+		{
+			struct HeadPartsData
+			{
+				bool Clear;
+				std::vector<RE::BGSHeadPart*> AddPartVec;
+				std::vector<RE::BGSHeadPart*> DeletePartVec;
+			};
+
+			struct MorphsData
+			{
+				bool Clear;
+				std::unordered_map<std::uint32_t, float> SetMorphMap;
+				std::vector<std::uint32_t> DeleteMorphVec;
+			};
+
+			struct TintsData
+			{
+				bool Clear;
+				std::unordered_map<std::uint16_t, std::pair<std::uint32_t, float>> SetTintMap;
+				std::vector<std::uint16_t> DeleteTintVec;
+			};
+
+			std::optional<RE::TESClass*> Class;
+			std::optional<RE::TESCombatStyle*> CombatStyle;
+			std::optional<RE::BGSOutfit*> DefaultOutfit;
+			std::optional<std::string> FullName;
+			std::optional<RE::BGSColorForm*> HairColor;
+			std::optional<HeadPartsData> HeadParts;
+			std::optional<RE::BGSTextureSet*> HeadTexture;
+			std::optional<float> HeightMin;
+			std::optional<float> HeightMax;
+			std::optional<bool> IsChargenFacePreset;
+			std::optional<MorphsData> Morphs;
+			std::optional<RE::TESRace*> Race;
+			std::optional<std::uint8_t> Sex;
+			std::optional<RE::TESObjectARMO*> Skin;
+			std::optional<TintsData> Tints;
+			std::optional<float> WeightFat;
+			std::optional<float> WeightMuscular;
+			std::optional<float> WeightThin;
+		};
+
+		// Flattened, read-only form of PatchData kept for the rest of the session. Field presence is a
+		// bitmask, and head parts, morphs, tints and names live in pools owned by PatchIndex.
+		struct CompactPatchData
+		{
+			enum Field : std::uint32_t
+			{
+				kClass = 1u << 0,
+				kCombatStyle = 1u << 1,
+				kDefaultOutfit = 1u << 2,
+				kFullName = 1u << 3,
+				kHairColor = 1u << 4,
+				kHeadParts = 1u << 5,
+				kHeadTexture = 1u << 6,
+				kHeightMax = 1u << 7,
+				kHeightMin = 1u << 8,
+				kIsChargenFacePreset = 1u << 9,
+				kMorphs = 1u << 10,
+				kRace = 1u << 11,
+				kSex = 1u << 12,
+				kSkin = 1u << 13,
+				kTints = 1u << 14,
+				kWeightFat = 1u << 15,
+				kWeightMuscular = 1u << 16,
+				kWeightThin = 1u << 17,
+				kClearHeadParts = 1u << 18,
+				kClearMorphs = 1u << 19,
+				kClearTints = 1u << 20
+			};
+
+			struct PoolRange
+			{
+				std::uint32_t Offset;
+				std::uint32_t Count;
+			};
+
+			struct MorphEntry
+			{
+				std::uint32_t Key;
+				float Value;
+			};
+
+			struct TintEntry
+			{
+				std::uint16_t Index;
+				std::uint32_t Color;
+				float Alpha;
+			};
+
+			bool Has(Field a_field) const { return (Fields & a_field) != 0; }
+
+			std::uint32_t Fields;
+			std::uint8_t Sex;
+			bool IsChargenFacePreset;
+			RE::TESClass* Class;
+			RE::TESCombatStyle* CombatStyle;
+			RE::BGSOutfit* DefaultOutfit;
+			RE::BGSColorForm* HairColor;
+			RE::BGSTextureSet* HeadTexture;
+			RE::TESRace* Race;
+			RE::TESObjectARMO* Skin;
+			float HeightMax;
+			float HeightMin;
+			float WeightFat;
+			float WeightMuscular;
+			float WeightThin;
+			std::uint32_t FullNameOffset;
+			PoolRange AddHeadParts;
+			PoolRange DeleteHeadParts;
+			PoolRange SetMorphs;
+			PoolRange DeleteMorphs;
+			PoolRange SetTints;
+			PoolRange DeleteTints;
+		};
+
+		// Read-only lookup used by the ClearStaticData hook, which runs for every NPC while most of them are
+		// not patched. A FormID-hashed bitmap rejects those with a single load; the remaining hits probe an
+		// open-addressing table that points into a dense CompactPatchData array.
+		class PatchIndex
+		{
+		public:
+			using PoolRange = CompactPatchData::PoolRange;
+			using MorphEntry = CompactPatchData::MorphEntry;
+			using TintEntry = CompactPatchData::TintEntry;
+
+			// Compacts and indexes a_patchMap, then releases it.
+			void Build(Utils::PatchTable<RE::TESNPC, PatchData>& a_patchMap)
+			{
+				npcs_.clear();
+				patchData_.clear();
+				filter_.clear();
+				slots_.clear();
+
+				if (a_patchMap.empty())
+				{
+					return;
+				}
+
+				npcs_.reserve(a_patchMap.size());
+				patchData_.reserve(a_patchMap.size());
+
+				const auto filterBits = std::max<std::size_t>(std::bit_ceil(a_patchMap.size() * 16), 4096);
+				const auto slotCount = std::bit_ceil(a_patchMap.size() * 2);
+				filterShift_ = 64 - std::countr_zero(filterBits);
+				slotShift_ = 64 - std::countr_zero(slotCount);
+				filter_.assign(filterBits / 64, 0);
+				slots_.assign(slotCount, 0);
+
+				for (const auto& [npc, patchData] : a_patchMap)
+				{
+					const auto hash = Hash(npc->GetFormID());
+					const auto filterIndex = hash >> filterShift_;
+					filter_[filterIndex >> 6] |= 1ull << (filterIndex & 63);
+
+					auto slotIndex = hash >> slotShift_;
+					while (slots_[slotIndex] != 0)
+					{
+						slotIndex = (slotIndex + 1) & (slots_.size() - 1);
+					}
+
+					npcs_.emplace_back(npc);
+					patchData_.emplace_back(Compact(patchData));
+					slots_[slotIndex] = static_cast<std::uint32_t>(npcs_.size());
+				}
+
+				a_patchMap.clear();
+
+				headPartPool_.shrink_to_fit();
+				morphPool_.shrink_to_fit();
+				morphKeyPool_.shrink_to_fit();
+				tintPool_.shrink_to_fit();
+				tintIndexPool_.shrink_to_fit();
+				namePool_.shrink_to_fit();
+			}
+
+			const CompactPatchData* Find(const RE::TESNPC* a_npc) const
+			{
+				if (npcs_.empty())
+				{
+					return nullptr;
+				}
+
+				const auto hash = Hash(a_npc->GetFormID());
+				const auto filterIndex = hash >> filterShift_;
+				if ((filter_[filterIndex >> 6] & (1ull << (filterIndex & 63))) == 0)
+				{
+					return nullptr;
+				}
+
+				for (auto slotIndex = hash >> slotShift_; slots_[slotIndex] != 0; slotIndex = (slotIndex + 1) & (slots_.size() - 1))
+				{
+					const auto denseIndex = slots_[slotIndex] - 1;
+					if (npcs_[denseIndex] == a_npc)
+					{
+						return std::addressof(patchData_[denseIndex]);
+					}
+				}
+
+				return nullptr;
+			}
+
+			std::span<RE::BGSHeadPart* const> GetHeadParts(PoolRange a_range) const { return View(headPartPool_, a_range); }
+			std::span<const MorphEntry> GetMorphs(PoolRange a_range) const { return View(morphPool_, a_range); }
+			std::span<const std::uint32_t> GetMorphKeys(PoolRange a_range) const { return View(morphKeyPool_, a_range); }
+			std::span<const TintEntry> GetTints(PoolRange a_range) const { return View(tintPool_, a_range); }
+			std::span<const std::uint16_t> GetTintIndices(PoolRange a_range) const { return View(tintIndexPool_, a_range); }
+			const char* GetFullName(std::uint32_t a_offset) const { return namePool_.c_str() + a_offset; }
+
+			std::size_t size() const { return npcs_.size(); }
+
+		private:
+			static std::uint64_t Hash(std::uint32_t a_formID)
+			{
+				return static_cast<std::uint64_t>(a_formID) * 0x9E3779B97F4A7C15ull;
+			}
+
+			template <typename T>
+			static std::span<const T> View(const std::vector<T>& a_pool, PoolRange a_range)
+			{
+				return std::span<const T>(a_pool.data() + a_range.Offset, a_range.Count);
+			}
+
+			template <typename T, typename RangeT>
+			static PoolRange Append(std::vector<T>& a_pool, const RangeT& a_values)
+			{
+				const auto offset = static_cast<std::uint32_t>(a_pool.size());
+				a_pool.insert(a_pool.end(), a_values.begin(), a_values.end());
+				return PoolRange{ offset, static_cast<std::uint32_t>(a_pool.size() - offset) };
+			}
+
+			template <typename T>
+			static void SetField(CompactPatchData& a_compact, CompactPatchData::Field a_field, T& a_value, const std::optional<T>& a_source)
+			{
+				if (a_source.has_value())
+				{
+					a_compact.Fields |= a_field;
+					a_value = a_source.value();
+				}
+			}
+
+			CompactPatchData Compact(const PatchData& a_patchData)
+			{
+				CompactPatchData compact{};
+
+				SetField(compact, CompactPatchData::kClass, compact.Class, a_patchData.Class);
+				SetField(compact, CompactPatchData::kCombatStyle, compact.CombatStyle, a_patchData.CombatStyle);
+				SetField(compact, CompactPatchData::kDefaultOutfit, compact.DefaultOutfit, a_patchData.DefaultOutfit);
+				SetField(compact, CompactPatchData::kHairColor, compact.HairColor, a_patchData.HairColor);
+				SetField(compact, CompactPatchData::kHeadTexture, compact.HeadTexture, a_patchData.HeadTexture);
+				SetField(compact, CompactPatchData::kHeightMax, compact.HeightMax, a_patchData.HeightMax);
+				SetField(compact, CompactPatchData::kHeightMin, compact.HeightMin, a_patchData.HeightMin);
+				SetField(compact, CompactPatchData::kIsChargenFacePreset, compact.IsChargenFacePreset, a_patchData.IsChargenFacePreset);
+				SetField(compact, CompactPatchData::kRace, compact.Race, a_patchData.Race);
+				SetField(compact, CompactPatchData::kSex, compact.Sex, a_patchData.Sex);
+				SetField(compact, CompactPatchData::kSkin, compact.Skin, a_patchData.Skin);
+				SetField(compact, CompactPatchData::kWeightFat, compact.WeightFat, a_patchData.WeightFat);
+				SetField(compact, CompactPatchData::kWeightMuscular, compact.WeightMuscular, a_patchData.WeightMuscular);
+				SetField(compact, CompactPatchData::kWeightThin, compact.WeightThin, a_patchData.WeightThin);
+
+				if (a_patchData.FullName.has_value())
+				{
+					compact.Fields |= CompactPatchData::kFullName;
+					compact.FullNameOffset = static_cast<std::uint32_t>(namePool_.size());
+					namePool_.append(a_patchData.FullName.value());
+					namePool_.push_back('\0');
+				}
+
+				if (a_patchData.HeadParts.has_value())
+				{
+					compact.Fields |= CompactPatchData::kHeadParts;
+					if (a_patchData.HeadParts->Clear)
+					{
+						compact.Fields |= CompactPatchData::kClearHeadParts;
+					}
+					compact.AddHeadParts = Append(headPartPool_, a_patchData.HeadParts->AddPartVec);
+					compact.DeleteHeadParts = Append(headPartPool_, a_patchData.HeadParts->DeletePartVec);
+				}
+
+				// Morph and tint sets are pooled in key order so they are applied deterministically.
+				if (a_patchData.Morphs.has_value())
+				{
+					compact.Fields |= CompactPatchData::kMorphs;
+					if (a_patchData.Morphs->Clear)
+					{
+						compact.Fields |= CompactPatchData::kClearMorphs;
+					}
+
+					compact.SetMorphs = Append(morphPool_, a_patchData.Morphs->SetMorphMap | std::views::transform([](const auto& a_pair) { return MorphEntry{ a_pair.first, a_pair.second }; }));
+					std::ranges::sort(std::span(morphPool_).subspan(compact.SetMorphs.Offset), {}, &MorphEntry::Key);
+					compact.DeleteMorphs = Append(morphKeyPool_, a_patchData.Morphs->DeleteMorphVec);
+				}
+
+				if (a_patchData.Tints.has_value())
+				{
+					compact.Fields |= CompactPatchData::kTints;
+					if (a_patchData.Tints->Clear)
+					{
+						compact.Fields |= CompactPatchData::kClearTints;
+					}
+
+					compact.SetTints = Append(tintPool_, a_patchData.Tints->SetTintMap | std::views::transform([](const auto& a_pair) { return TintEntry{ a_pair.first, a_pair.second.first, a_pair.second.second }; }));
+					std::ranges::sort(std::span(tintPool_).subspan(compact.SetTints.Offset), {}, &TintEntry::Index);
+					compact.DeleteTints = Append(tintIndexPool_, a_patchData.Tints->DeleteTintVec);
+				}
+
+				return compact;
+			}
+
+			std::vector<RE::TESNPC*> npcs_;
+			std::vector<CompactPatchData> patchData_;
+			std::vector<std::uint64_t> filter_;
+			std::vector<std::uint32_t> slots_;
+			std::vector<RE::BGSHeadPart*> headPartPool_;
+			std::vector<MorphEntry> morphPool_;
+			std::vector<std::uint32_t> morphKeyPool_;
+			std::vector<TintEntry> tintPool_;
+			std::vector<std::uint16_t> tintIndexPool_;
+			std::string namePool_;
+			int filterShift_ = 64;
+			int slotShift_ = 64;
+		};
+
+		std::vector<Parsers::Statement<ConfigData>> g_configVec;
+		Utils::PatchTable<RE::TESNPC, PatchData> g_patchMap;
+		PatchIndex g_patchIndex;
+		std::once_flag g_prepareFlag;
+		std::atomic<const PatchIndex*> g_publishedIndex{ nullptr };
+
+		const FormFilters::PredicateContext g_predicateContext{
+			{ RE::ENUM_FORM_ID::kNPC_ },
+			{
+				{ "HeightMax", [](RE::TESForm* a_form) { return static_cast<RE::TESNPC*>(a_form)->heightMax; } },
+				{ "HeightMin", [](RE::TESForm* a_form) { return static_cast<RE::TESNPC*>(a_form)->height; } },
+				{ "WeightFat", [](RE::TESForm* a_form) { return static_cast<RE::TESNPC*>(a_form)->morphWeight.z; } },
+				{ "WeightMuscular", [](RE::TESForm* a_form) { return static_cast<RE::TESNPC*>(a_form)->morphWeight.y; } },
+				{ "WeightThin", [](RE::TESForm* a_form) { return static_cast<RE::TESNPC*>(a_form)->morphWeight.x; } },
+			}
+		};
+
+		class NPCParser : public Parsers::Parser<ConfigData>
+		{
+		public:
+			NPCParser(std::string_view a_configPath) : Parsers::Parser<ConfigData>(a_configPath) {}
+
+		protected:
+			std::optional<Parsers::Statement<ConfigData>> ParseExpressionStatement() override
+			{
+				ConfigData configData{};
+
+				if (!ParseFilter(configData))
+				{
+					return std::nullopt;
+				}
+
+				auto token = reader.GetToken();
+				if (token != ".")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				if (!ParseElement(configData))
+				{
+					return std::nullopt;
+				}
+
+				token = reader.Peek();
+				if (token == "=")
+				{
+					if (!ParseAssignment(configData))
+					{
+						return std::nullopt;
+					}
+				}
+				else
+				{
+					do
+					{
+						token = reader.GetToken();
+						if (token != ".")
+						{
+							logger::warn("Line {}, Col {}: Syntax error. Expected '.'.", reader.GetLastLine(), reader.GetLastLineIndex());
+							return std::nullopt;
+						}
+
+						if (!ParseOperation(configData))
+						{
+							return std::nullopt;
+						}
+					} while (reader.Peek() == ".");
+				}
+
+				token = reader.GetToken();
+				if (token != ";")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ';'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return std::nullopt;
+				}
+
+				return Parsers::Statement<ConfigData>::CreateExpressionStatement(configData);
+			}
+
+			void PrintExpressionStatement(const ConfigData& a_configData, int a_indent) override
+			{
+				auto indent = std::string(a_indent * 4, ' ');
+
+				switch (a_configData.Element)
+				{
+				case ElementType::kHeadParts:
+					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
+					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
+					{
+						std::string opLog;
+
+						switch (a_configData.Operations[opIndex].OpType)
+						{
+						case OperationType::kClear:
+							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
+							break;
+
+						case OperationType::kAdd:
+						case OperationType::kDelete:
+							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<std::string>(a_configData.Operations[opIndex].OpData.value()));
+							break;
+						}
+
+						if (opIndex == a_configData.Operations.size() - 1)
+						{
+							opLog += ";";
+						}
+
+						logger::info("{}    {}", indent, opLog);
+					}
+					break;
+
+				case ElementType::kMorphs:
+					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
+					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
+					{
+						std::string opLog;
+
+						switch (a_configData.Operations[opIndex].OpType)
+						{
+						case OperationType::kClear:
+							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
+							break;
+
+						case OperationType::kSet:
+							opLog = fmt::format(".{}({:08X}, {})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<ConfigData::Operation::MorphData>(a_configData.Operations[opIndex].OpData.value()).Key,
+								std::any_cast<ConfigData::Operation::MorphData>(a_configData.Operations[opIndex].OpData.value()).Value);
+							break;
+
+						case OperationType::kDelete:
+							opLog = fmt::format(".{}({:08X})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<ConfigData::Operation::MorphData>(a_configData.Operations[opIndex].OpData.value()).Key);
+							break;
+						}
+
+						if (opIndex == a_configData.Operations.size() - 1)
+						{
+							opLog += ";";
+						}
+
+						logger::info("{}    {}", indent, opLog);
+					}
+					break;
+
+				case ElementType::kTints:
+					logger::info("{}{}({}).{}", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm, ElementTypeToString(a_configData.Element));
+					for (std::size_t opIndex = 0; opIndex < a_configData.Operations.size(); ++opIndex)
+					{
+						std::string opLog;
+
+						switch (a_configData.Operations[opIndex].OpType)
+						{
+						case OperationType::kClear:
+							opLog = fmt::format(".{}()", OperationTypeToString(a_configData.Operations[opIndex].OpType));
+							break;
+
+						case OperationType::kSet:
+							opLog = fmt::format(".{}({}, {}, {}, {}, {})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Index,
+								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Color & static_cast<std::uint32_t>(UINT8_MAX),
+								(std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Color >> 8) & static_cast<std::uint32_t>(UINT8_MAX),
+								(std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Color >> 16) & static_cast<std::uint32_t>(UINT8_MAX),
+								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Alpha);
+							break;
+
+						case OperationType::kDelete:
+							opLog = fmt::format(".{}({})", OperationTypeToString(a_configData.Operations[opIndex].OpType),
+								std::any_cast<ConfigData::Operation::TintData>(a_configData.Operations[opIndex].OpData.value()).Index);
+							break;
+						}
+
+						if (opIndex == a_configData.Operations.size() - 1)
+						{
+							opLog += ";";
+						}
+
+						logger::info("{}    {}", indent, opLog);
+					}
+					break;
+
+				case ElementType::kHeightMax:
+				case ElementType::kHeightMin:
+				case ElementType::kWeightFat:
+				case ElementType::kWeightMuscular:
+				case ElementType::kWeightThin:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
+						ElementTypeToString(a_configData.Element), std::any_cast<float>(a_configData.AssignValue.value()));
+					break;
+
+				case ElementType::kClass:
+				case ElementType::kCombatStyle:
+				case ElementType::kDefaultOutfit:
+				case ElementType::kHairColor:
+				case ElementType::kHeadTexture:
+				case ElementType::kRace:
+				case ElementType::kSkin:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
+						ElementTypeToString(a_configData.Element), std::any_cast<std::string>(a_configData.AssignValue.value()));
+					break;
+
+				case ElementType::kFullName:
+					logger::info("{}{}({}).{} = \"{}\";", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
+						ElementTypeToString(a_configData.Element), std::any_cast<std::string>(a_configData.AssignValue.value()));
+					break;
+
+				case ElementType::kIsChargenFacePreset:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
+						ElementTypeToString(a_configData.Element), std::any_cast<bool>(a_configData.AssignValue.value()));
+					break;
+
+				case ElementType::kSex:
+					logger::info("{}{}({}).{} = {};", indent, FilterTypeToString(a_configData.Filter), a_configData.FilterForm,
+						ElementTypeToString(a_configData.Element), std::any_cast<std::uint8_t>(a_configData.AssignValue.value()));
+					break;
+				}
+			}
+
+			bool ParseFilter(ConfigData& a_config)
+			{
+				auto token = reader.GetToken();
+				if (token == "FilterByFormID")
+				{
+					a_config.Filter = FilterType::kFormID;
+				}
+				else if (token == "FilterByEditorID")
+				{
+					a_config.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_config.Filter = FilterType::kEditorIDPattern;
+				}
+				else if (token == "FilterByKeyword")
+				{
+					a_config.Filter = FilterType::kKeyword;
+				}
+				else if (token == "FilterByPredicates")
+				{
+					a_config.Filter = FilterType::kPredicates;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				const auto filterFormOpt = a_config.Filter == FilterType::kPredicates ? ParsePredicates(g_predicateContext) : ParseFilterForm(a_config.Filter);
+				if (!filterFormOpt.has_value())
+				{
+					return false;
+				}
+
+				a_config.FilterForm = filterFormOpt.value();
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseElement(ConfigData& a_config)
+			{
+				const auto token = reader.GetToken();
+				if (token == "Class")
+				{
+					a_config.Element = ElementType::kClass;
+				}
+				else if (token == "CombatStyle")
+				{
+					a_config.Element = ElementType::kCombatStyle;
+				}
+				else if (token == "DefaultOutfit")
+				{
+					a_config.Element = ElementType::kDefaultOutfit;
+				}
+				else if (token == "FullName")
+				{
+					a_config.Element = ElementType::kFullName;
+				}
+				else if (token == "HairColor")
+				{
+					a_config.Element = ElementType::kHairColor;
+				}
+				else if (token == "HeadParts")
+				{
+					a_config.Element = ElementType::kHeadParts;
+				}
+				else if (token == "HeadTexture")
+				{
+					a_config.Element = ElementType::kHeadTexture;
+				}
+				else if (token == "HeightMax")
+				{
+					a_config.Element = ElementType::kHeightMax;
+				}
+				else if (token == "HeightMin")
+				{
+					a_config.Element = ElementType::kHeightMin;
+				}
+				else if (token == "IsChargenFacePreset")
+				{
+					a_config.Element = ElementType::kIsChargenFacePreset;
+				}
+				else if (token == "Morphs")
+				{
+					a_config.Element = ElementType::kMorphs;
+				}
+				else if (token == "Race")
+				{
+					a_config.Element = ElementType::kRace;
+				}
+				else if (token == "Sex")
+				{
+					a_config.Element = ElementType::kSex;
+				}
+				else if (token == "Skin")
+				{
+					a_config.Element = ElementType::kSkin;
+				}
+				else if (token == "Tints")
+				{
+					a_config.Element = ElementType::kTints;
+				}
+				else if (token == "WeightFat")
+				{
+					a_config.Element = ElementType::kWeightFat;
+				}
+				else if (token == "WeightMuscular")
+				{
+					a_config.Element = ElementType::kWeightMuscular;
+				}
+				else if (token == "WeightThin")
+				{
+					a_config.Element = ElementType::kWeightThin;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid ElementName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseAssignment(ConfigData& a_config)
+			{
+				auto token = reader.GetToken();
+				if (token != "=")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '='.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				if (a_config.Element == ElementType::kClass || a_config.Element == ElementType::kCombatStyle || a_config.Element == ElementType::kDefaultOutfit ||
+					a_config.Element == ElementType::kHairColor || a_config.Element == ElementType::kHeadTexture || a_config.Element == ElementType::kRace || a_config.Element == ElementType::kSkin)
+				{
+					token = reader.Peek();
+					if (token == "null")
+					{
+						a_config.AssignValue = std::any(std::string(reader.GetToken()));
+						return true;
+					}
+
+					const auto formOpt = ParseForm();
+					if (!formOpt.has_value())
+					{
+						return false;
+					}
+
+					a_config.AssignValue = std::any(formOpt.value());
+				}
+				else if (a_config.Element == ElementType::kFullName)
+				{
+					const auto fullNameOpt = ParseString();
+					if (!fullNameOpt.has_value())
+					{
+						return false;
+					}
+
+					a_config.AssignValue = std::any(fullNameOpt.value());
+				}
+				else if (a_config.Element == ElementType::kHeightMax || a_config.Element == ElementType::kHeightMin ||
+						 a_config.Element == ElementType::kWeightFat || a_config.Element == ElementType::kWeightMuscular || a_config.Element == ElementType::kWeightThin)
+				{
+					const auto valueOpt = ParseNumber<float>();
+					if (!valueOpt.has_value())
+					{
+						return false;
+					}
+
+					a_config.AssignValue = std::any(valueOpt.value());
+				}
+				else if (a_config.Element == ElementType::kIsChargenFacePreset)
+				{
+					token = reader.GetToken();
+					if (token == "true")
+					{
+						a_config.AssignValue = std::any(true);
+					}
+					else if (token == "false")
+					{
+						a_config.AssignValue = std::any(false);
+					}
+					else
+					{
+						logger::warn("Line {}, Col {}: Invalid value '{}'. For IsChargenFacePreset, the value must be 'true' or 'false'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+						return false;
+					}
+				}
+				else if (a_config.Element == ElementType::kSex)
+				{
+					const auto sexOpt = ParseNumber<std::uint8_t>();
+					if (!sexOpt.has_value())
+					{
+						return false;
+					}
+
+					if (sexOpt.value() != 0 && sexOpt.value() != 1)
+					{
+						logger::warn("Line {}, Col {}: Invalid value '{}'. For Sex, the value must be 0 or 1.", reader.GetLastLine(), reader.GetLastLineIndex(), sexOpt.value());
+						return false;
+					}
+
+					a_config.AssignValue = std::any(sexOpt.value());
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid Assignment for '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_config.Element));
+					return false;
+				}
+
+				return true;
+			}
+
+			bool ParseOperation(ConfigData& a_config)
+			{
+				ConfigData::Operation newOp{};
+
+				auto token = reader.GetToken();
+				if (token == "Clear")
+				{
+					newOp.OpType = OperationType::kClear;
+				}
+				else if (token == "Add")
+				{
+					newOp.OpType = OperationType::kAdd;
+				}
+				else if (token == "Set")
+				{
+					newOp.OpType = OperationType::kSet;
+				}
+				else if (token == "Delete")
+				{
+					newOp.OpType = OperationType::kDelete;
+				}
+				else
+				{
+					logger::warn("Line {}, Col {}: Invalid OperationName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+					return false;
+				}
+
+				auto isValidOperation = [](ElementType elem, OperationType op) -> bool {
+					switch (elem)
+					{
+					case ElementType::kHeadParts:
+						return op == OperationType::kClear || op == OperationType::kAdd || op == OperationType::kDelete;
+					case ElementType::kMorphs:
+					case ElementType::kTints:
+						return op == OperationType::kClear || op == OperationType::kSet || op == OperationType::kDelete;
+					default:
+						return false;
+					}
+				}(a_config.Element, newOp.OpType);
+
+				if (!isValidOperation)
+				{
+					logger::warn("Line {}, Col {}: Invalid Operation '{}.{}()'.", reader.GetLastLine(), reader.GetLastLineIndex(), ElementTypeToString(a_config.Element), OperationTypeToString(newOp.OpType));
+					return false;
+				}
+
+				token = reader.GetToken();
+				if (token != "(")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected '('.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				switch (a_config.Element)
+				{
+				case ElementType::kHeadParts:
+					if (newOp.OpType != OperationType::kClear)
+					{
+						const auto formOpt = ParseForm();
+						if (!formOpt.has_value())
+						{
+							return false;
+						}
+
+						newOp.OpData = std::any(formOpt.value());
+					}
+
+					break;
+
+				case ElementType::kMorphs:
+					if (newOp.OpType != OperationType::kClear)
+					{
+						ConfigData::Operation::MorphData morphData{};
+
+						token = reader.GetToken();
+						if (!IsHexString(token))
+						{
+							logger::warn("Line {}, Col {}: Expected morphKey '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+							return false;
+						}
+
+						const auto morphKeyOpt = Utils::ParseHex(token);
+						if (!morphKeyOpt.has_value())
+						{
+							logger::warn("Line {}, Col {}: Failed to parse morphKey '{}'. The value must be a hexadecimal number.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
+							return false;
+						}
+
+						morphData.Key = morphKeyOpt.value();
+
+						if (newOp.OpType == OperationType::kSet)
+						{
+							token = reader.GetToken();
+							if (token != ",")
+							{
+								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+								return false;
+							}
+
+							const auto morphValueOpt = ParseNumber<float>();
+							if (!morphValueOpt.has_value())
+							{
+								return false;
+							}
+
+							if (morphValueOpt.value() < 0.0f || morphValueOpt.value() > 1.0f)
+							{
+								logger::warn("Line {}, Col {}: Invalid morphValue '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), morphValueOpt.value());
+								return false;
+							}
+
+							morphData.Value = morphValueOpt.value();
+						}
+
+						newOp.OpData = std::any(morphData);
+					}
+
+					break;
+
+				case ElementType::kTints:
+					if (newOp.OpType != OperationType::kClear)
+					{
+						ConfigData::Operation::TintData tintData{};
+
+						const auto indexOpt = ParseNumber<std::uint16_t>();
+						if (!indexOpt.has_value())
+						{
+							return false;
+						}
+						tintData.Index = indexOpt.value();
+
+						if (newOp.OpType == OperationType::kSet)
+						{
+							token = reader.GetToken();
+							if (token != ",")
+							{
+								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+								return false;
+							}
+
+							const auto tintColorRedOpt = ParseNumber<std::uint8_t>();
+							if (!tintColorRedOpt.has_value())
+							{
+								return false;
+							}
+
+							std::uint32_t tintColor = tintColorRedOpt.value();
+
+							token = reader.GetToken();
+							if (token != ",")
+							{
+								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+								return false;
+							}
+
+							const auto tintColorGreenOpt = ParseNumber<std::uint8_t>();
+							if (!tintColorGreenOpt.has_value())
+							{
+								return false;
+							}
+
+							tintColor |= tintColorGreenOpt.value() << 8;
+
+							token = reader.GetToken();
+							if (token != ",")
+							{
+								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+								return false;
+							}
+
+							const auto tintColorBlueOpt = ParseNumber<std::uint8_t>();
+							if (!tintColorBlueOpt.has_value())
+							{
+								return false;
+							}
+
+							tintColor |= tintColorBlueOpt.value() << 16;
+							tintData.Color = tintColor;
+
+							token = reader.GetToken();
+							if (token != ",")
+							{
+								logger::warn("Line {}, Col {}: Syntax error. Expected ','.", reader.GetLastLine(), reader.GetLastLineIndex());
+								return false;
+							}
+
+							const auto tintAlphaOpt = ParseNumber<float>();
+							if (!tintAlphaOpt.has_value())
+							{
+								return false;
+							}
+
+							if (tintAlphaOpt.value() < 0.0f || tintAlphaOpt.value() > 1.0f)
+							{
+								logger::warn("Line {}, Col {}: Invalid tintAlpha '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), tintAlphaOpt.value());
+								return false;
+							}
+
+							tintData.Alpha = tintAlphaOpt.value();
+						}
+
+						newOp.OpData = std::any(tintData);
+					}
+
+					break;
+				}
+
+				token = reader.GetToken();
+				if (token != ")")
+				{
+					logger::warn("Line {}, Col {}: Syntax error. Expected ')'.", reader.GetLastLine(), reader.GetLastLineIndex());
+					return false;
+				}
+
+				a_config.Operations.emplace_back(newOp);
+
+				return true;
+			}
+		};
+
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
+		{
+			if (a_configData.Element == ElementType::kClass)
+			{
+				const auto classFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (classFormStr == "null")
+				{
+					a_patchData.Class = nullptr;
+				}
+				else
+				{
+					auto* classForm = Utils::GetFormFromString(classFormStr);
+					if (!classForm)
+					{
+						logger::warn("Invalid Form: '{}'.", classFormStr);
+						return;
+					}
+
+					auto* class_ = classForm->As<RE::TESClass>();
+					if (!class_)
+					{
+						logger::warn("'{}' is not a Class.", classFormStr);
+						return;
+					}
+
+					a_patchData.Class = class_;
+				}
+			}
+			else if (a_configData.Element == ElementType::kCombatStyle)
+			{
+				const auto combatStyleFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (combatStyleFormStr == "null")
+				{
+					a_patchData.CombatStyle = nullptr;
+				}
+				else
+				{
+					auto* combatStyleForm = Utils::GetFormFromString(combatStyleFormStr);
+					if (!combatStyleForm)
+					{
+						logger::warn("Invalid Form: '{}'.", combatStyleFormStr);
+						return;
+					}
+
+					auto* combatStyle = combatStyleForm->As<RE::TESCombatStyle>();
+					if (!combatStyle)
+					{
+						logger::warn("'{}' is not a CombatStyle.", combatStyleFormStr);
+						return;
+					}
+
+					a_patchData.CombatStyle = combatStyle;
+				}
+			}
+			else if (a_configData.Element == ElementType::kDefaultOutfit)
+			{
+				const auto outfitFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (outfitFormStr == "null")
+				{
+					a_patchData.DefaultOutfit = nullptr;
+				}
+				else
+				{
+					auto* outfitForm = Utils::GetFormFromString(outfitFormStr);
+					if (!outfitForm)
+					{
+						logger::warn("Invalid Form: '{}'.", outfitFormStr);
+						return;
+					}
+
+					auto* outfit = outfitForm->As<RE::BGSOutfit>();
+					if (!outfit)
+					{
+						logger::warn("'{}' is not a Outfit.", outfitFormStr);
+						return;
+					}
+
+					a_patchData.DefaultOutfit = outfit;
+				}
+			}
+			else if (a_configData.Element == ElementType::kFullName)
+			{
+				a_patchData.FullName = std::any_cast<std::string>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kHairColor)
+			{
+				const auto colorFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (colorFormStr == "null")
+				{
+					a_patchData.HairColor = nullptr;
+				}
+				else
+				{
+					auto* colorForm = Utils::GetFormFromString(colorFormStr);
+					if (!colorForm)
+					{
+						logger::warn("Invalid Form: '{}'.", colorFormStr);
+						return;
+					}
+
+					auto* color = colorForm->As<RE::BGSColorForm>();
+					if (!color)
+					{
+						logger::warn("'{}' is not a Color.", colorFormStr);
+						return;
+					}
+
+					a_patchData.HairColor = color;
+				}
+			}
+			else if (a_configData.Element == ElementType::kHeadParts)
+			{
+				if (!a_patchData.HeadParts.has_value())
+				{
+					a_patchData.HeadParts = PatchData::HeadPartsData{};
+				}
+
+				for (const auto& op : a_configData.Operations)
+				{
+					if (op.OpType == OperationType::kClear)
+					{
+						a_patchData.HeadParts->Clear = true;
+					}
+					else if (op.OpType == OperationType::kAdd || op.OpType == OperationType::kDelete)
+					{
+						const auto opFormStr = std::any_cast<std::string>(op.OpData.value());
+
+						auto* opForm = Utils::GetFormFromString(opFormStr);
+						if (!opForm)
+						{
+							logger::warn("Invalid Form: '{}'.", opFormStr);
+							continue;
+						}
+
+						auto* headPart = opForm->As<RE::BGSHeadPart>();
+						if (!headPart)
+						{
+							logger::warn("'{}' is not a HeadPart.", opFormStr);
+							continue;
+						}
+
+						if (op.OpType == OperationType::kAdd)
+						{
+							a_patchData.HeadParts->AddPartVec.emplace_back(headPart);
+						}
+						else
+						{
+							a_patchData.HeadParts->DeletePartVec.emplace_back(headPart);
+						}
+					}
+				}
+			}
+			else if (a_configData.Element == ElementType::kHeadTexture)
+			{
+				const auto texFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (texFormStr == "null")
+				{
+					a_patchData.HeadTexture = nullptr;
+				}
+				else
+				{
+					auto* texForm = Utils::GetFormFromString(texFormStr);
+					if (!texForm)
+					{
+						logger::warn("Invalid Form: '{}'.", texFormStr);
+						return;
+					}
+
+					auto* textureSet = texForm->As<RE::BGSTextureSet>();
+					if (!textureSet)
+					{
+						logger::warn("'{}' is not a TextureSet.", texFormStr);
+						return;
+					}
+
+					a_patchData.HeadTexture = textureSet;
+				}
+			}
+			else if (a_configData.Element == ElementType::kHeightMax)
+			{
+				a_patchData.HeightMax = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kHeightMin)
+			{
+				a_patchData.HeightMin = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kIsChargenFacePreset)
+			{
+				a_patchData.IsChargenFacePreset = std::any_cast<bool>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kMorphs)
+			{
+				if (!a_patchData.Morphs.has_value())
+				{
+					a_patchData.Morphs = PatchData::MorphsData{};
+				}
+
+				for (const auto& op : a_configData.Operations)
+				{
+					if (op.OpType == OperationType::kClear)
+					{
+						a_patchData.Morphs->Clear = true;
+					}
+					else if (op.OpType == OperationType::kSet || op.OpType == OperationType::kDelete)
+					{
+						const auto morphData = std::any_cast<ConfigData::Operation::MorphData>(op.OpData.value());
+
+						if (op.OpType == OperationType::kSet)
+						{
+							a_patchData.Morphs->SetMorphMap.insert(std::make_pair(morphData.Key, morphData.Value));
+						}
+						else
+						{
+							a_patchData.Morphs->DeleteMorphVec.emplace_back(morphData.Key);
+						}
+					}
+				}
+			}
+			else if (a_configData.Element == ElementType::kRace)
+			{
+				const auto raceFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (raceFormStr == "null")
+				{
+					a_patchData.Race = nullptr;
+				}
+				else
+				{
+					auto* raceForm = Utils::GetFormFromString(raceFormStr);
+					if (!raceForm)
+					{
+						logger::warn("Invalid Form: '{}'.", raceFormStr);
+						return;
+					}
+
+					auto* race = raceForm->As<RE::TESRace>();
+					if (!race)
+					{
+						logger::warn("'{}' is not a Race.", raceFormStr);
+						return;
+					}
+
+					a_patchData.Race = race;
+				}
+			}
+			else if (a_configData.Element == ElementType::kSex)
+			{
+				a_patchData.Sex = std::any_cast<std::uint8_t>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kSkin)
+			{
+				const auto armoFormStr = std::any_cast<std::string>(a_configData.AssignValue.value());
+
+				if (armoFormStr == "null")
+				{
+					a_patchData.Skin = nullptr;
+				}
+				else
+				{
+					auto* armoForm = Utils::GetFormFromString(armoFormStr);
+					if (!armoForm)
+					{
+						logger::warn("Invalid Form: '{}'.", armoFormStr);
+						return;
+					}
+
+					auto* armo = armoForm->As<RE::TESObjectARMO>();
+					if (!armo)
+					{
+						logger::warn("'{}' is not a Armor.", armoFormStr);
+						return;
+					}
+
+					a_patchData.Skin = armo;
+				}
+			}
+			else if (a_configData.Element == ElementType::kTints)
+			{
+				if (!a_patchData.Tints.has_value())
+				{
+					a_patchData.Tints = PatchData::TintsData{};
+				}
+
+				for (const auto& op : a_configData.Operations)
+				{
+					if (op.OpType == OperationType::kClear)
+					{
+						a_patchData.Tints->Clear = true;
+					}
+					else if (op.OpType == OperationType::kSet || op.OpType == OperationType::kDelete)
+					{
+						const auto tintData = std::any_cast<ConfigData::Operation::TintData>(op.OpData.value());
+
+						if (op.OpType == OperationType::kSet)
+						{
+							a_patchData.Tints->SetTintMap.insert(std::make_pair(tintData.Index, std::make_pair(tintData.Color, tintData.Alpha)));
+						}
+						else
+						{
+							a_patchData.Tints->DeleteTintVec.emplace_back(tintData.Index);
+						}
+					}
+				}
+			}
+			else if (a_configData.Element == ElementType::kWeightFat)
+			{
+				a_patchData.WeightFat = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kWeightMuscular)
+			{
+				a_patchData.WeightMuscular = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+			else if (a_configData.Element == ElementType::kWeightThin)
+			{
+				a_patchData.WeightThin = std::any_cast<float>(a_configData.AssignValue.value());
+			}
+		}
+
+		std::vector<RE::TESNPC*> GetTargets(const ConfigData& a_configData)
+		{
+			return ConfigUtils::GetFilteredForms<RE::TESNPC>(a_configData, "an NPC");
+		}
+
+		// Resolves the targets, builds the patch data and compacts it into the index. Resolution walks the NPC form
+		// array and reads NPC data, so this runs on the main thread before the engine goes on loading.
+		void PrepareIndex()
+		{
+			logger::info("======================== Start preparing patch for {} ========================", kTypeName);
+
+			auto prepareStart = std::chrono::high_resolution_clock::now();
+
+			ConfigUtils::Prepare(g_configVec, g_patchMap, GetTargets, PreparePatchData);
+			g_patchMap.Freeze();
+			g_patchIndex.Build(g_patchMap);
+
+			// Only the compact index is used from here on.
+			std::vector<Parsers::Statement<ConfigData>>().swap(g_configVec);
+			FormFilters::Clear();
+
+			auto prepareEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> prepareDuration = prepareEnd - prepareStart;
+
+			logger::info("Indexed {} patched NPCs in {} seconds.", g_patchIndex.size(), prepareDuration.count());
+
+			logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
+			logger::info("");
+
+			g_publishedIndex.store(std::addressof(g_patchIndex), std::memory_order_release);
+		}
+
+		// Returns the published index. If the hook runs before PreparePatch(), the first caller prepares inline
+		// and any other caller blocks until it is done.
+		const PatchIndex& GetPatchIndex()
+		{
+			if (const auto* patchIndex = g_publishedIndex.load(std::memory_order_acquire))
+			{
+				return *patchIndex;
+			}
+
+			std::call_once(g_prepareFlag, PrepareIndex);
+			return *g_publishedIndex.load(std::memory_order_acquire);
+		}
+
+
+		void AddHeadPart(RE::TESNPC* a_npc, RE::BGSHeadPart* a_hdpt)
+		{
+			using func_t = void (*)(RE::TESNPC*, RE::BGSHeadPart*, std::uint32_t, std::uint32_t);
+			const REL::Relocation<func_t> func{ REL::ID(735660) };
+			func(a_npc, a_hdpt, 1, false);
+		}
+
+		void RemoveHeadPart(RE::TESNPC* a_npc, RE::BGSHeadPart* a_hdpt)
+		{
+			using func_t = void (*)(RE::TESNPC*, RE::BGSHeadPart*, bool);
+			const REL::Relocation<func_t> func{ REL::ID(880456) };
+			func(a_npc, a_hdpt, true);
+		}
+
+		void ClearHeadParts(RE::TESNPC* a_npc)
+		{
+			if (a_npc->headParts)
+			{
+				RE::free(a_npc->headParts);
+			}
+			a_npc->headParts = nullptr;
+			a_npc->numHeadParts = 0;
+		}
+
+		void PatchHeadParts(RE::TESNPC* a_npc, bool a_clear, std::span<RE::BGSHeadPart* const> a_addParts, std::span<RE::BGSHeadPart* const> a_deleteParts)
+		{
+			bool cleared = false;
+
+			// Clear
+			if (a_clear)
+			{
+				ClearHeadParts(a_npc);
+				cleared = true;
+			}
+
+			// Delete
+			if (!cleared)
+			{
+				for (const auto& delPart : a_deleteParts)
+				{
+					RemoveHeadPart(a_npc, delPart);
+				}
+			}
+
+			// Add
+			for (const auto& addPart : a_addParts)
+			{
+				AddHeadPart(a_npc, addPart);
+			}
+		}
+
+
+		void SetMorphSliderValue(RE::TESNPC* a_npc, std::uint32_t a_morphKey, float a_morphValue)
+		{
+			using func_t = decltype(&SetMorphSliderValue);
+			const REL::Relocation<func_t> func{ REL::ID(1432151) };
+			func(a_npc, a_morphKey, a_morphValue);
+		}
+
+		void PatchMorphs(RE::TESNPC* a_npc, bool a_clear, std::span<const PatchIndex::MorphEntry> a_setMorphs, std::span<const std::uint32_t> a_deleteMorphs)
+		{
+			if (a_clear)
+			{
+				if (a_npc->morphSliderValues)
+				{
+					a_npc->morphSliderValues->clear();
+				}
+			}
+
+			// Delete
+			if (a_npc->morphSliderValues)
+			{
+				for (auto deleteKey : a_deleteMorphs)
+				{
+					SetMorphSliderValue(a_npc, deleteKey, 0);
+				}
+			}
+
+			// Set
+			for (const auto& morph : a_setMorphs)
+			{
+				SetMorphSliderValue(a_npc, morph.Key, morph.Value);
+			}
+		}
+
+
+		void SetTintingData(RE::TESNPC* a_npc, std::uint16_t a_index, float a_value, std::uint32_t a_color)
+		{
+			using func_t = decltype(&SetTintingData);
+			const REL::Relocation<func_t> func{ REL::ID(452734) };
+			func(a_npc, a_index, a_value, a_color);
+		}
+
+		void PatchTints(RE::TESNPC* a_npc, bool a_clear, std::span<const PatchIndex::TintEntry> a_setTints, std::span<const std::uint16_t> a_deleteTints)
+		{
+			auto tintingData = reinterpret_cast<RE::BSTArray<RE::BGSCharacterTint::Entries*>*>(a_npc->tintingData);
+
+			if (a_clear)
+			{
+				if (tintingData)
+				{
+					tintingData->clear();
+				}
+			}
+
+			// Delete
+			if (tintingData)
+			{
+				for (auto deleteIndex : a_deleteTints)
+				{
+					SetTintingData(a_npc, deleteIndex, 0, UINT32_MAX);
+				}
+			}
+
+			// Set
+			for (const auto& tint : a_setTints)
+			{
+				SetTintingData(a_npc, tint.Index, tint.Alpha, tint.Color);
+			}
+		}
+
+
+		template <std::uint64_t id, std::ptrdiff_t diff>
+		class TESNPC_ClearStaticDataHook
+		{
+		public:
+			static void Install()
+			{
+				REL::Relocation<std::uintptr_t> target(REL::ID(id), diff);
+				func = *(func_t*)(target.get());
+				REL::safe_write(target.get(), (std::uintptr_t)ProcessHook);
+			}
+
+		private:
+			using func_t = void (*)(RE::TESNPC&);
+
+			static void Patch_PreFunc(RE::TESNPC* a_npc, const CompactPatchData& a_patchData, const PatchIndex& a_patchIndex)
+			{
+				if (a_patchData.Has(CompactPatchData::kFullName))
+				{
+					a_npc->fullName = a_patchIndex.GetFullName(a_patchData.FullNameOffset);
+				}
+
+				if (a_patchData.Has(CompactPatchData::kHeightMax))
+				{
+					a_npc->heightMax = a_patchData.HeightMax;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kHeightMin))
+				{
+					a_npc->height = a_patchData.HeightMin;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kIsChargenFacePreset))
+				{
+					if (a_patchData.IsChargenFacePreset)
+					{
+						a_npc->actorData.actorBaseFlags |= RE::ACTOR_BASE_DATA::Flag::kIsChargenFacePreset;
+					}
+					else
+					{
+						if (a_npc->actorData.actorBaseFlags & RE::ACTOR_BASE_DATA::Flag::kIsChargenFacePreset)
+						{
+							a_npc->actorData.actorBaseFlags -= RE::ACTOR_BASE_DATA::Flag::kIsChargenFacePreset;
+						}
+					}
+				}
+
+				if (a_patchData.Has(CompactPatchData::kRace))
+				{
+					a_npc->formRace = a_patchData.Race;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kSex))
+				{
+					if (a_patchData.Sex)
+					{
+						// Female
+						a_npc->actorData.actorBaseFlags |= RE::ACTOR_BASE_DATA::Flag::kFemale;
+					}
+					else
+					{
+						// Male
+						if (a_npc->actorData.actorBaseFlags & RE::ACTOR_BASE_DATA::Flag::kFemale)
+						{
+							a_npc->actorData.actorBaseFlags -= RE::ACTOR_BASE_DATA::Flag::kFemale;
+						}
+					}
+				}
+
+				if (a_patchData.Has(CompactPatchData::kSkin))
+				{
+					a_npc->formSkin = a_patchData.Skin;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kWeightFat))
+				{
+					a_npc->morphWeight.z = a_patchData.WeightFat;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kWeightMuscular))
+				{
+					a_npc->morphWeight.y = a_patchData.WeightMuscular;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kWeightThin))
+				{
+					a_npc->morphWeight.x = a_patchData.WeightThin;
+				}
+			}
+
+			static void Patch_PostFunc(RE::TESNPC* a_npc, const CompactPatchData& a_patchData, const PatchIndex& a_patchIndex)
+			{
+				if (a_patchData.Has(CompactPatchData::kClass))
+				{
+					a_npc->cl = a_patchData.Class;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kCombatStyle))
+				{
+					a_npc->combatStyle = a_patchData.CombatStyle;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kDefaultOutfit))
+				{
+					a_npc->defOutfit = a_patchData.DefaultOutfit;
+				}
+
+				if (a_patchData.Has(CompactPatchData::kHairColor))
+				{
+					if (a_npc->headRelatedData)
+					{
+						a_npc->headRelatedData->hairColor = a_patchData.HairColor;
+					}
+				}
+
+				if (a_patchData.Has(CompactPatchData::kHeadTexture))
+				{
+					if (a_npc->headRelatedData)
+					{
+						a_npc->headRelatedData->faceDetails = a_patchData.HeadTexture;
+					}
+				}
+
+				if (a_patchData.Has(CompactPatchData::kHeadParts))
+				{
+					PatchHeadParts(a_npc, a_patchData.Has(CompactPatchData::kClearHeadParts), a_patchIndex.GetHeadParts(a_patchData.AddHeadParts), a_patchIndex.GetHeadParts(a_patchData.DeleteHeadParts));
+				}
+
+				if (a_patchData.Has(CompactPatchData::kMorphs))
+				{
+					PatchMorphs(a_npc, a_patchData.Has(CompactPatchData::kClearMorphs), a_patchIndex.GetMorphs(a_patchData.SetMorphs), a_patchIndex.GetMorphKeys(a_patchData.DeleteMorphs));
+				}
+
+				if (a_patchData.Has(CompactPatchData::kTints))
+				{
+					PatchTints(a_npc, a_patchData.Has(CompactPatchData::kClearTints), a_patchIndex.GetTints(a_patchData.SetTints), a_patchIndex.GetTintIndices(a_patchData.DeleteTints));
+				}
+			}
+
+			static void ProcessHook(RE::TESNPC& a_npc)
+			{
+				const auto& patchIndex = GetPatchIndex();
+
+				const auto* patchData = patchIndex.Find(&a_npc);
+				if (!patchData)
+				{
+					func(a_npc);
+					return;
+				}
+
+				Patch_PreFunc(&a_npc, *patchData, patchIndex);
+				func(a_npc);
+				Patch_PostFunc(&a_npc, *patchData, patchIndex);
+			}
+
+			inline static func_t func;
+		};
+	}  // namespace
+
+	void ReadConfigs()
+	{
+		g_configVec = ConfigUtils::ReadConfigs<NPCParser, Parsers::Statement<ConfigData>>(kTypeName);
+	}
+
+	void Install()
+	{
+		TESNPC_ClearStaticDataHook<1261646, 0xB0>::Install();
+	}
+
+	void PreparePatch()
+	{
+		std::call_once(g_prepareFlag, PrepareIndex);
+	}
+}  // namespace NPCs
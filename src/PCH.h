@@ -1,20 +1,20 @@
-#pragma once
-
-#pragma warning(push)
-#include "F4SE/F4SE.h"
-#include "RE/Fallout.h"
-
-#ifdef NDEBUG
-#	include <spdlog/sinks/basic_file_sink.h>
-#else
-#	include <spdlog/sinks/msvc_sink.h>
-#endif
-#pragma warning(pop)
-
-#define DLLEXPORT __declspec(dllexport)
-
-namespace logger = F4SE::log;
-
-using namespace std::literals;
-
-#include "Version.h"
+#pragma once
+
+#pragma warning(push)
+#include "F4SE/F4SE.h"
+#include "RE/Fallout.h"
+
+#ifdef NDEBUG
+#	include <spdlog/sinks/basic_file_sink.h>
+#else
+#	include <spdlog/sinks/msvc_sink.h>
+#endif
+#pragma warning(pop)
+
+#define DLLEXPORT __declspec(dllexport)
+
+namespace logger = F4SE::log;
+
+using namespace std::literals;
+
+#include "Version.h"
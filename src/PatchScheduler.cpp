@@ -0,0 +1,429 @@
+#include "PatchScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace PatchScheduler
+{
+	namespace
+	{
+		// Set by ScopedLogCapture; messages logged on that thread are collected here instead of written.
+		thread_local LogBuffer* t_logBuffer = nullptr;
+
+		std::shared_ptr<spdlog::sinks::sink> g_targetSink;
+
+		// Threads currently running a task or a ParallelFor chunk. Idle pool threads are not counted, so
+		// the cores they leave free near the end of a run can be used to prepare the remaining subsystems.
+		std::atomic<std::uint32_t> g_busyThreadCount = 0;
+
+		class BufferedSink final : public spdlog::sinks::sink
+		{
+		public:
+			explicit BufferedSink(std::shared_ptr<spdlog::sinks::sink> a_sink) : sink_(std::move(a_sink)) {}
+
+			void log(const spdlog::details::log_msg& a_msg) override
+			{
+				if (t_logBuffer)
+				{
+					t_logBuffer->emplace_back(a_msg);
+					return;
+				}
+
+				sink_->log(a_msg);
+			}
+
+			void flush() override
+			{
+				if (!t_logBuffer)
+				{
+					sink_->flush();
+				}
+			}
+
+			void set_pattern(const std::string& a_pattern) override
+			{
+				sink_->set_pattern(a_pattern);
+			}
+
+			void set_formatter(std::unique_ptr<spdlog::formatter> a_formatter) override
+			{
+				sink_->set_formatter(std::move(a_formatter));
+			}
+
+		private:
+			std::shared_ptr<spdlog::sinks::sink> sink_;
+		};
+
+		std::uint32_t GetHardwareThreadCount()
+		{
+			return std::max(std::thread::hardware_concurrency(), 1u);
+		}
+
+		std::uint32_t AcquireThreads(std::uint32_t a_requestCount)
+		{
+			const auto hardwareThreadCount = GetHardwareThreadCount();
+
+			auto busyThreadCount = g_busyThreadCount.load();
+			while (true)
+			{
+				const auto grantCount = busyThreadCount < hardwareThreadCount ? std::min(a_requestCount, hardwareThreadCount - busyThreadCount) : 0;
+				if (grantCount == 0)
+				{
+					return 0;
+				}
+
+				if (g_busyThreadCount.compare_exchange_weak(busyThreadCount, busyThreadCount + grantCount))
+				{
+					return grantCount;
+				}
+			}
+		}
+
+		// Persistent worker threads shared by Run and ParallelFor, started on first use. The threads are detached
+		// and the pool is never destroyed, so nothing has to join them while the plugin is unloaded. Jobs must not
+		// throw; both job types catch exceptions themselves and hand them back to the thread that waits for them.
+		class WorkerPool
+		{
+		public:
+			static WorkerPool& GetSingleton()
+			{
+				static auto* singleton = new WorkerPool(GetHardwareThreadCount());
+				return *singleton;
+			}
+
+			void Submit(std::function<void()> a_job)
+			{
+				{
+					std::scoped_lock lock(mutex_);
+					jobQueue_.emplace_back(std::move(a_job));
+				}
+
+				jobCondition_.notify_one();
+			}
+
+		private:
+			explicit WorkerPool(std::uint32_t a_threadCount)
+			{
+				for (std::uint32_t threadIndex = 0; threadIndex < a_threadCount; ++threadIndex)
+				{
+					std::thread([this]() { WorkerLoop(); }).detach();
+				}
+			}
+
+			void WorkerLoop()
+			{
+				while (true)
+				{
+					std::function<void()> job;
+
+					{
+						std::unique_lock lock(mutex_);
+						jobCondition_.wait(lock, [&]() { return !jobQueue_.empty(); });
+
+						job = std::move(jobQueue_.front());
+						jobQueue_.pop_front();
+					}
+
+					job();
+				}
+			}
+
+			std::mutex mutex_;
+			std::condition_variable jobCondition_;
+			std::deque<std::function<void()>> jobQueue_;
+		};
+
+		// Shared by a ParallelFor call and its helper jobs. A helper may only start after the call has returned,
+		// in which case it finds no chunk left and exits without touching a_func.
+		struct ParallelForState
+		{
+			ParallelForState(std::size_t a_count, std::size_t a_grainSize, const std::function<void(std::size_t)>& a_func) :
+				Count(a_count), GrainSize(a_grainSize), Func(a_func), PendingChunkCount((a_count + a_grainSize - 1) / a_grainSize)
+			{
+			}
+
+			const std::size_t Count;
+			const std::size_t GrainSize;
+			const std::function<void(std::size_t)>& Func;
+			std::atomic<std::size_t> NextIndex = 0;
+			std::atomic<bool> Failed = false;
+
+			std::mutex Mutex;
+			std::condition_variable DoneCondition;
+			std::size_t PendingChunkCount;
+			std::exception_ptr Exception;
+		};
+
+		// Claims chunks until none are left. After a chunk has thrown, the remaining chunks are still claimed and
+		// counted, but no longer run, so the caller is woken once every chunk is accounted for.
+		void RunChunks(ParallelForState& a_state)
+		{
+			for (auto beginIndex = a_state.NextIndex.fetch_add(a_state.GrainSize); beginIndex < a_state.Count; beginIndex = a_state.NextIndex.fetch_add(a_state.GrainSize))
+			{
+				if (!a_state.Failed)
+				{
+					try
+					{
+						const auto endIndex = std::min(beginIndex + a_state.GrainSize, a_state.Count);
+						for (auto index = beginIndex; index < endIndex; ++index)
+						{
+							a_state.Func(index);
+						}
+					} catch (...)
+					{
+						std::scoped_lock lock(a_state.Mutex);
+						if (!a_state.Exception)
+						{
+							a_state.Exception = std::current_exception();
+						}
+
+						a_state.Failed = true;
+					}
+				}
+
+				std::scoped_lock lock(a_state.Mutex);
+				if (--a_state.PendingChunkCount == 0)
+				{
+					a_state.DoneCondition.notify_all();
+				}
+			}
+		}
+
+		bool Intersects(const std::vector<RE::ENUM_FORM_ID>& a_lhs, const std::vector<RE::ENUM_FORM_ID>& a_rhs)
+		{
+			return std::ranges::any_of(a_lhs, [&](RE::ENUM_FORM_ID a_formType) {
+				return std::ranges::find(a_rhs, a_formType) != a_rhs.end();
+			});
+		}
+
+		// Two tasks conflict when either writes a form type the other reads or writes.
+		bool Conflicts(const Task& a_earlier, const Task& a_later)
+		{
+			return Intersects(a_earlier.Writes, a_later.Writes) || Intersects(a_earlier.Writes, a_later.Reads) || Intersects(a_earlier.Reads, a_later.Writes);
+		}
+
+		void RunTask(const Task& a_task)
+		{
+			auto taskStart = std::chrono::high_resolution_clock::now();
+
+			a_task.Patch();
+
+			auto taskEnd = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> taskDuration = taskEnd - taskStart;
+
+			logger::info("{} patch execution time: {} seconds", a_task.Name, taskDuration.count());
+			logger::info("");
+		}
+	}
+
+	ScopedLogCapture::ScopedLogCapture(LogBuffer& a_logBuffer) : previousLogBuffer_(t_logBuffer)
+	{
+		t_logBuffer = std::addressof(a_logBuffer);
+	}
+
+	ScopedLogCapture::~ScopedLogCapture()
+	{
+		t_logBuffer = previousLogBuffer_;
+	}
+
+	std::shared_ptr<spdlog::sinks::sink> WrapSink(std::shared_ptr<spdlog::sinks::sink> a_sink)
+	{
+		g_targetSink = a_sink;
+		return std::make_shared<BufferedSink>(std::move(a_sink));
+	}
+
+	void ReplayLog(LogBuffer& a_logBuffer)
+	{
+		if (a_logBuffer.empty())
+		{
+			return;
+		}
+
+		if (t_logBuffer)
+		{
+			std::move(a_logBuffer.begin(), a_logBuffer.end(), std::back_inserter(*t_logBuffer));
+		}
+		else if (g_targetSink)
+		{
+			for (const auto& msg : a_logBuffer)
+			{
+				g_targetSink->log(msg);
+			}
+
+			g_targetSink->flush();
+		}
+
+		LogBuffer().swap(a_logBuffer);
+	}
+
+	void ParallelFor(std::size_t a_count, std::size_t a_grainSize, const std::function<void(std::size_t)>& a_func)
+	{
+		if (a_count == 0)
+		{
+			return;
+		}
+
+		const auto grainSize = std::max<std::size_t>(a_grainSize, 1);
+		const auto chunkCount = (a_count + grainSize - 1) / grainSize;
+		const auto helperCount = chunkCount > 1 ? AcquireThreads(static_cast<std::uint32_t>(std::min<std::size_t>(chunkCount - 1, UINT32_MAX))) : 0;
+
+		const auto state = std::make_shared<ParallelForState>(a_count, grainSize, a_func);
+
+		auto& workerPool = WorkerPool::GetSingleton();
+		for (std::uint32_t helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+		{
+			workerPool.Submit([state]() {
+				RunChunks(*state);
+				--g_busyThreadCount;
+			});
+		}
+
+		RunChunks(*state);
+
+		{
+			std::unique_lock lock(state->Mutex);
+			state->DoneCondition.wait(lock, [&]() { return state->PendingChunkCount == 0; });
+		}
+
+		if (state->Exception)
+		{
+			std::rethrow_exception(state->Exception);
+		}
+	}
+
+	void Run(const std::vector<Task>& a_tasks)
+	{
+		const auto taskCount = a_tasks.size();
+		if (taskCount == 0)
+		{
+			return;
+		}
+
+		// Edges only point from earlier to later tasks, so the graph is acyclic and the declared order is one valid schedule.
+		std::vector<std::vector<std::size_t>> dependentsVec(taskCount);
+		std::vector<std::size_t> pendingCounts(taskCount, 0);
+
+		for (std::size_t laterIndex = 1; laterIndex < taskCount; ++laterIndex)
+		{
+			for (std::size_t earlierIndex = 0; earlierIndex < laterIndex; ++earlierIndex)
+			{
+				if (Conflicts(a_tasks[earlierIndex], a_tasks[laterIndex]))
+				{
+					dependentsVec[earlierIndex].emplace_back(laterIndex);
+					++pendingCounts[laterIndex];
+				}
+			}
+		}
+
+		const auto workerCount = std::min<std::size_t>(GetHardwareThreadCount(), taskCount);
+		if (workerCount <= 1)
+		{
+			for (const auto& task : a_tasks)
+			{
+				RunTask(task);
+			}
+
+			return;
+		}
+
+		logger::info("Scheduling {} patch tasks on {} workers.", taskCount, workerCount);
+
+		std::mutex mutex;
+		std::condition_variable doneCondition;
+		std::vector<LogBuffer> logBuffers(taskCount);
+		std::vector<bool> finishedVec(taskCount, false);
+		std::size_t runningCount = 0;
+		std::size_t nextFlushIndex = 0;
+		std::size_t failedIndex = taskCount;
+		std::exception_ptr exception;
+
+		auto& workerPool = WorkerPool::GetSingleton();
+
+		// Each ready task is its own pool job, so a pool thread is free for ParallelFor chunks between tasks.
+		// Called with mutex held.
+		std::function<void(std::size_t)> submitTask;
+		submitTask = [&](std::size_t a_taskIndex) {
+			++runningCount;
+
+			workerPool.Submit([&, a_taskIndex]() {
+				std::exception_ptr taskException;
+
+				++g_busyThreadCount;
+
+				{
+					ScopedLogCapture logCapture(logBuffers[a_taskIndex]);
+
+					try
+					{
+						RunTask(a_tasks[a_taskIndex]);
+					} catch (...)
+					{
+						taskException = std::current_exception();
+					}
+				}
+
+				--g_busyThreadCount;
+
+				std::scoped_lock lock(mutex);
+
+				finishedVec[a_taskIndex] = true;
+				--runningCount;
+
+				// The first failed task in declared order is the one reported, as in a sequential run. Tasks that are
+				// already running are let finish, but no further task is started.
+				if (taskException && a_taskIndex < failedIndex)
+				{
+					failedIndex = a_taskIndex;
+					exception = taskException;
+				}
+
+				if (!exception)
+				{
+					for (const auto dependentIndex : dependentsVec[a_taskIndex])
+					{
+						if (--pendingCounts[dependentIndex] == 0)
+						{
+							submitTask(dependentIndex);
+						}
+					}
+				}
+
+				// Logs are written as soon as every earlier task has finished, keeping the sequential order.
+				while (nextFlushIndex < taskCount && finishedVec[nextFlushIndex])
+				{
+					ReplayLog(logBuffers[nextFlushIndex]);
+					++nextFlushIndex;
+				}
+
+				doneCondition.notify_all();
+			});
+		};
+
+		std::unique_lock lock(mutex);
+
+		for (std::size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+		{
+			if (pendingCounts[taskIndex] == 0)
+			{
+				submitTask(taskIndex);
+			}
+		}
+
+		doneCondition.wait(lock, [&]() { return runningCount == 0; });
+
+		if (exception)
+		{
+			// Tasks after a gap left by skipped tasks have not been flushed yet.
+			for (; nextFlushIndex < taskCount; ++nextFlushIndex)
+			{
+				ReplayLog(logBuffers[nextFlushIndex]);
+			}
+
+			std::rethrow_exception(exception);
+		}
+	}
+}  // namespace PatchScheduler
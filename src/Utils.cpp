@@ -1,108 +1,351 @@
-#include "Utils.h"
-
-namespace Utils
-{
-	namespace
-	{
-		std::string_view Trim(std::string_view a_str)
-		{
-			std::size_t sIdx, eIdx;
-
-			for (sIdx = 0; sIdx < a_str.length(); ++sIdx)
-			{
-				if (!std::isspace(static_cast<unsigned char>(a_str[sIdx])))
-				{
-					break;
-				}
-			}
-
-			if (sIdx >= a_str.length())
-			{
-				return std::string_view{};
-			}
-
-			for (eIdx = a_str.length(); eIdx > 0; --eIdx)
-			{
-				if (!std::isspace(static_cast<unsigned char>(a_str[eIdx - 1])))
-				{
-					break;
-				}
-			}
-
-			return a_str.substr(sIdx, eIdx - sIdx);
-		}
-
-		std::optional<std::uint32_t> ParseFormID(std::string_view a_formIdStr)
-		{
-			const auto formIdOpt = ParseHex(a_formIdStr);
-			if (!formIdOpt.has_value())
-			{
-				return std::nullopt;
-			}
-			return formIdOpt.value() & 0xFFFFFFu;
-		}
-	}  // namespace
-
-	std::optional<std::uint32_t> ParseHex(std::string_view a_hexStr)
-	{
-		try
-		{
-			return std::stoul(std::string(a_hexStr), nullptr, 16);
-		} catch (...)
-		{
-			return std::nullopt;
-		}
-	}
-
-	bool IsPluginExists(std::string_view a_pluginName)
-	{
-		auto* g_dataHandler = RE::TESDataHandler::GetSingleton();
-		if (!g_dataHandler)
-		{
-			return false;
-		}
-
-		const auto* mod = g_dataHandler->LookupModByName(a_pluginName);
-		if (!mod)
-		{
-			return false;
-		}
-
-		return mod->IsActive();
-	}
-
-	RE::TESForm* GetFormFromIdentifier(std::string_view a_pluginName, std::uint32_t a_formID)
-	{
-		auto* g_dataHandler = RE::TESDataHandler::GetSingleton();
-		if (!g_dataHandler)
-		{
-			return nullptr;
-		}
-
-		return g_dataHandler->LookupForm(a_formID, a_pluginName);
-	}
-
-	RE::TESForm* GetFormFromIdentifier(std::string_view pluginName, std::string_view formIdStr)
-	{
-		const auto formIdOpt = ParseFormID(formIdStr);
-		if (!formIdOpt.has_value())
-		{
-			return nullptr;
-		}
-		return GetFormFromIdentifier(pluginName, formIdOpt.value());
-	}
-
-	RE::TESForm* GetFormFromString(std::string_view a_formStr)
-	{
-		const auto delimiter = a_formStr.find('|');
-		if (delimiter == std::string_view::npos)
-		{
-			return nullptr;
-		}
-
-		const auto pluginName = Trim(a_formStr.substr(0, delimiter));
-		const auto formID = Trim(a_formStr.substr(delimiter + 1));
-
-		return Utils::GetFormFromIdentifier(pluginName, formID);
-	}
-}  // namespace Utils
+#include "Utils.h"
+
+#include <atomic>
+#include <execution>
+#include <mutex>
+#include <shared_mutex>
+
+namespace Utils
+{
+	namespace
+	{
+		// Case-folded plugin name -> load order information, built once at kGameDataReady.
+		std::unordered_map<std::string, PluginInfo, CaseInsensitiveHash, CaseInsensitiveEqual> g_pluginIndex;
+		bool g_pluginIndexBuilt = false;
+
+		// Plugin name -> (local FormID -> resolved form). Failed lookups are stored as nullptr.
+		std::unordered_map<std::string, std::unordered_map<std::uint32_t, RE::TESForm*>, CaseInsensitiveHash, CaseInsensitiveEqual> g_formCache;
+		std::atomic<std::size_t> g_formCacheHits = 0;
+		std::atomic<std::size_t> g_formCacheMisses = 0;
+		std::atomic<std::size_t> g_formCacheNegatives = 0;
+
+		// Patch subsystems and their prepare workers look forms up concurrently. Almost every lookup is a hit
+		// after ResolvePendingForms, so hits share the lock and only misses take it exclusively.
+		std::shared_mutex g_formCacheMutex;
+
+		// Form references collected while parsing, grouped by plugin and resolved in bulk by ResolvePendingForms.
+		std::unordered_map<std::string, std::vector<std::uint32_t>, CaseInsensitiveHash, CaseInsensitiveEqual> g_pendingForms;
+
+		std::string_view Trim(std::string_view a_str)
+		{
+			std::size_t sIdx, eIdx;
+
+			for (sIdx = 0; sIdx < a_str.length(); ++sIdx)
+			{
+				if (!std::isspace(static_cast<unsigned char>(a_str[sIdx])))
+				{
+					break;
+				}
+			}
+
+			if (sIdx >= a_str.length())
+			{
+				return std::string_view{};
+			}
+
+			for (eIdx = a_str.length(); eIdx > 0; --eIdx)
+			{
+				if (!std::isspace(static_cast<unsigned char>(a_str[eIdx - 1])))
+				{
+					break;
+				}
+			}
+
+			return a_str.substr(sIdx, eIdx - sIdx);
+		}
+
+		std::optional<std::uint32_t> ParseFormID(std::string_view a_formIdStr)
+		{
+			const auto formIdOpt = ParseHex(a_formIdStr);
+			if (!formIdOpt.has_value())
+			{
+				return std::nullopt;
+			}
+			return formIdOpt.value() & 0xFFFFFFu;
+		}
+	}  // namespace
+
+	std::optional<std::uint32_t> ParseHex(std::string_view a_hexStr)
+	{
+		if (a_hexStr.starts_with("0x") || a_hexStr.starts_with("0X"))
+		{
+			a_hexStr.remove_prefix(2);
+		}
+
+		std::uint32_t value = 0;
+		const auto result = std::from_chars(a_hexStr.data(), a_hexStr.data() + a_hexStr.size(), value, 16);
+		if (result.ec != std::errc{} || result.ptr == a_hexStr.data())
+		{
+			return std::nullopt;
+		}
+
+		return value;
+	}
+
+	void BuildPluginIndex()
+	{
+		auto* g_dataHandler = RE::TESDataHandler::GetSingleton();
+		if (!g_dataHandler)
+		{
+			return;
+		}
+
+		g_pluginIndex.clear();
+
+		for (auto* file : g_dataHandler->files)
+		{
+			if (!file)
+			{
+				continue;
+			}
+
+			PluginInfo pluginInfo{};
+			pluginInfo.IsActive = file->IsActive();
+			pluginInfo.IsLight = file->IsLight();
+			pluginInfo.CompileIndex = file->compileIndex;
+			pluginInfo.SmallFileCompileIndex = file->smallFileCompileIndex;
+			pluginInfo.File = file;
+
+			// LookupModByName returns the first match, so keep the first entry for duplicated names.
+			g_pluginIndex.emplace(std::string(file->filename), pluginInfo);
+		}
+
+		g_pluginIndexBuilt = true;
+	}
+
+	const PluginInfo* GetPluginInfo(std::string_view a_pluginName)
+	{
+		if (!g_pluginIndexBuilt)
+		{
+			BuildPluginIndex();
+		}
+
+		const auto it = g_pluginIndex.find(a_pluginName);
+		return it != g_pluginIndex.end() ? std::addressof(it->second) : nullptr;
+	}
+
+	std::optional<std::uint32_t> GetRuntimeFormID(const PluginInfo& a_pluginInfo, std::uint32_t a_formID)
+	{
+		if (!a_pluginInfo.IsActive)
+		{
+			return std::nullopt;
+		}
+
+		std::uint32_t formID = static_cast<std::uint32_t>(a_pluginInfo.CompileIndex) << 24;
+		if (a_pluginInfo.IsLight)
+		{
+			formID |= static_cast<std::uint32_t>(a_pluginInfo.SmallFileCompileIndex) << 12;
+			formID |= a_formID & 0xFFFu;
+		}
+		else
+		{
+			formID |= a_formID & 0xFFFFFFu;
+		}
+
+		return formID;
+	}
+
+	bool IsPluginExists(std::string_view a_pluginName)
+	{
+		const auto* pluginInfo = GetPluginInfo(a_pluginName);
+		if (!pluginInfo)
+		{
+			return false;
+		}
+
+		return pluginInfo->IsActive;
+	}
+
+	RE::TESForm* GetFormFromIdentifier(std::string_view a_pluginName, std::uint32_t a_formID)
+	{
+		auto* g_dataHandler = RE::TESDataHandler::GetSingleton();
+		if (!g_dataHandler)
+		{
+			return nullptr;
+		}
+
+		{
+			std::shared_lock lock(g_formCacheMutex);
+
+			const auto pluginIt = g_formCache.find(a_pluginName);
+			if (pluginIt != g_formCache.end())
+			{
+				const auto formIt = pluginIt->second.find(a_formID);
+				if (formIt != pluginIt->second.end())
+				{
+					g_formCacheHits++;
+					return formIt->second;
+				}
+			}
+		}
+
+		std::scoped_lock lock(g_formCacheMutex);
+
+		auto pluginIt = g_formCache.find(a_pluginName);
+		if (pluginIt == g_formCache.end())
+		{
+			pluginIt = g_formCache.emplace(std::string(a_pluginName), std::unordered_map<std::uint32_t, RE::TESForm*>{}).first;
+		}
+
+		auto& pluginCache = pluginIt->second;
+
+		const auto formIt = pluginCache.find(a_formID);
+		if (formIt != pluginCache.end())
+		{
+			g_formCacheHits++;
+			return formIt->second;
+		}
+
+		RE::TESForm* form = nullptr;
+
+		const auto* pluginInfo = GetPluginInfo(a_pluginName);
+		if (pluginInfo)
+		{
+			const auto runtimeFormIDOpt = GetRuntimeFormID(*pluginInfo, a_formID);
+			if (runtimeFormIDOpt.has_value())
+			{
+				form = RE::TESForm::GetFormByID(runtimeFormIDOpt.value());
+			}
+		}
+
+		g_formCacheMisses++;
+		if (!form)
+		{
+			g_formCacheNegatives++;
+		}
+
+		pluginCache.emplace(a_formID, form);
+		return form;
+	}
+
+	RE::TESForm* GetFormFromIdentifier(std::string_view pluginName, std::string_view formIdStr)
+	{
+		const auto formIdOpt = ParseFormID(formIdStr);
+		if (!formIdOpt.has_value())
+		{
+			return nullptr;
+		}
+		return GetFormFromIdentifier(pluginName, formIdOpt.value());
+	}
+
+	RE::TESForm* GetFormFromString(std::string_view a_formStr)
+	{
+		const auto delimiter = a_formStr.find('|');
+		if (delimiter == std::string_view::npos)
+		{
+			return nullptr;
+		}
+
+		const auto pluginName = Trim(a_formStr.substr(0, delimiter));
+		const auto formID = Trim(a_formStr.substr(delimiter + 1));
+
+		return Utils::GetFormFromIdentifier(pluginName, formID);
+	}
+
+	void AddPendingForm(std::string_view a_pluginName, std::string_view a_formIdStr)
+	{
+		const auto formIdOpt = ParseFormID(a_formIdStr);
+		if (!formIdOpt.has_value())
+		{
+			return;
+		}
+
+		auto it = g_pendingForms.find(a_pluginName);
+		if (it == g_pendingForms.end())
+		{
+			it = g_pendingForms.emplace(std::string(a_pluginName), std::vector<std::uint32_t>{}).first;
+		}
+
+		it->second.emplace_back(formIdOpt.value());
+	}
+
+	void ResolvePendingForms()
+	{
+		auto* g_dataHandler = RE::TESDataHandler::GetSingleton();
+		if (!g_dataHandler || g_pendingForms.empty())
+		{
+			return;
+		}
+
+		struct Request
+		{
+			std::unordered_map<std::uint32_t, RE::TESForm*>* PluginCache;
+			std::uint32_t LocalFormID;
+			std::optional<std::uint32_t> RuntimeFormID;
+		};
+
+		auto resolveStart = std::chrono::high_resolution_clock::now();
+
+		std::vector<Request> requests;
+
+		for (auto& [pluginName, formIDs] : g_pendingForms)
+		{
+			std::sort(formIDs.begin(), formIDs.end());
+			formIDs.erase(std::unique(formIDs.begin(), formIDs.end()), formIDs.end());
+
+			auto pluginIt = g_formCache.find(pluginName);
+			if (pluginIt == g_formCache.end())
+			{
+				pluginIt = g_formCache.emplace(pluginName, std::unordered_map<std::uint32_t, RE::TESForm*>{}).first;
+			}
+
+			auto& pluginCache = pluginIt->second;
+			pluginCache.reserve(pluginCache.size() + formIDs.size());
+
+			// The compile index only has to be looked up once per plugin.
+			const auto* pluginInfo = GetPluginInfo(pluginName);
+
+			for (const auto formID : formIDs)
+			{
+				if (pluginCache.contains(formID))
+				{
+					continue;
+				}
+
+				Request request{ std::addressof(pluginCache), formID, std::nullopt };
+				if (pluginInfo)
+				{
+					request.RuntimeFormID = GetRuntimeFormID(*pluginInfo, formID);
+				}
+
+				requests.emplace_back(request);
+			}
+		}
+
+		// Lookups only take the form map's read lock, so they can run concurrently.
+		std::vector<RE::TESForm*> results(requests.size(), nullptr);
+		std::transform(std::execution::par, requests.begin(), requests.end(), results.begin(), [](const Request& a_request) -> RE::TESForm* {
+			return a_request.RuntimeFormID.has_value() ? RE::TESForm::GetFormByID(a_request.RuntimeFormID.value()) : nullptr;
+		});
+
+		for (std::size_t index = 0; index < requests.size(); ++index)
+		{
+			requests[index].PluginCache->emplace(requests[index].LocalFormID, results[index]);
+			if (!results[index])
+			{
+				g_formCacheNegatives++;
+			}
+		}
+
+		g_formCacheMisses += requests.size();
+
+		auto resolveEnd = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double> resolveDuration = resolveEnd - resolveStart;
+
+		logger::info("Resolved {} form references from {} plugins in {} seconds", requests.size(), g_pendingForms.size(), resolveDuration.count());
+
+		g_pendingForms.clear();
+	}
+
+	void LogFormCacheStatistics()
+	{
+		std::size_t cachedForms = 0;
+		for (const auto& [pluginName, pluginCache] : g_formCache)
+		{
+			cachedForms += pluginCache.size();
+		}
+
+		logger::info("Form cache: {} plugins, {} forms ({} not found), {} hits, {} misses",
+			g_formCache.size(), cachedForms, g_formCacheNegatives.load(), g_formCacheHits.load(), g_formCacheMisses.load());
+	}
+}  // namespace Utils
@@ -4,6 +4,7 @@
 
 #include "ConfigUtils.h"
 #include "Parsers.h"
+#include "PatchTable.h"
 #include "Utils.h"
 
 namespace WorldSpaces
@@ -14,7 +15,9 @@ namespace WorldSpaces
 
 		enum class FilterType
 		{
-			kFormID
+			kFormID,
+			kEditorID,
+			kEditorIDPattern
 		};
 
 		std::string_view FilterTypeToString(FilterType a_value)
@@ -23,6 +26,10 @@ namespace WorldSpaces
 			{
 			case FilterType::kFormID:
 				return "FilterByFormID";
+			case FilterType::kEditorID:
+				return "FilterByEditorID";
+			case FilterType::kEditorIDPattern:
+				return "FilterByEditorIDPattern";
 			default:
 				return std::string_view{};
 			}
@@ -58,7 +65,7 @@ namespace WorldSpaces
 		};
 
 		std::vector<Parsers::Statement<ConfigData>> g_configVec;
-		std::unordered_map<RE::TESWorldSpace*, PatchData> g_patchMap;
+		Utils::PatchTable<RE::TESWorldSpace, PatchData> g_patchMap;
 
 		class WorldspaceParser : public Parsers::Parser<ConfigData>
 		{
@@ -122,6 +129,14 @@ namespace WorldSpaces
 				{
 					a_config.Filter = FilterType::kFormID;
 				}
+				else if (token == "FilterByEditorID")
+				{
+					a_config.Filter = FilterType::kEditorID;
+				}
+				else if (token == "FilterByEditorIDPattern")
+				{
+					a_config.Filter = FilterType::kEditorIDPattern;
+				}
 				else
 				{
 					logger::warn("Line {}, Col {}: Invalid FilterName '{}'.", reader.GetLastLine(), reader.GetLastLineIndex(), token);
@@ -135,7 +150,7 @@ namespace WorldSpaces
 					return false;
 				}
 
-				const auto filterFormOpt = ParseForm();
+				const auto filterFormOpt = ParseFilterForm(a_config.Filter);
 				if (!filterFormOpt.has_value())
 				{
 					return false;
@@ -198,32 +213,18 @@ namespace WorldSpaces
 			}
 		};
 
-		void Prepare(const ConfigData& a_configData)
+		void PreparePatchData(const ConfigData& a_configData, PatchData& a_patchData)
 		{
-			if (a_configData.Filter == FilterType::kFormID)
+			if (a_configData.Element == ElementType::kFullName)
 			{
-				auto* filterForm = Utils::GetFormFromString(a_configData.FilterForm);
-				if (!filterForm)
-				{
-					logger::warn("Invalid FilterForm: '{}'.", a_configData.FilterForm);
-					return;
-				}
-
-				auto* worldspace = filterForm->As<RE::TESWorldSpace>();
-				if (!worldspace)
-				{
-					logger::warn("'{}' is not a Worldspace.", a_configData.FilterForm);
-					return;
-				}
-
-				auto& patchData = g_patchMap[worldspace];
-
-				if (a_configData.Element == ElementType::kFullName)
-				{
-					patchData.FullName = a_configData.AssignValue.value();
-				}
+				a_patchData.FullName = a_configData.AssignValue.value();
 			}
 		}
+
+		std::vector<RE::TESWorldSpace*> GetTargets(const ConfigData& a_configData)
+		{
+			return ConfigUtils::GetFilteredForms<RE::TESWorldSpace>(a_configData, "a Worldspace");
+		}
 	}  // namespace
 
 	void ReadConfigs()
@@ -235,7 +236,8 @@ namespace WorldSpaces
 	{
 		logger::info("======================== Start preparing patch for {} ========================", kTypeName);
 
-		ConfigUtils::Prepare(g_configVec, Prepare);
+		ConfigUtils::Prepare(g_configVec, g_patchMap, GetTargets, PreparePatchData);
+		g_patchMap.Freeze();
 
 		logger::info("======================== Finished preparing patch for {} ========================", kTypeName);
 		logger::info("");
@@ -1,158 +1,177 @@
-#include "ArmorAddons.h"
-#include "Armors.h"
-#include "CObjs.h"
-#include "Cells.h"
-#include "CombatStyles.h"
-#include "Containers.h"
-#include "DefaultObjectManagers.h"
-#include "FormLists.h"
-#include "ImageSpaceAdapters.h"
-#include "Ingestibles.h"
-#include "Keywords.h"
-#include "LeveledLists.h"
-#include "Locations.h"
-#include "MusicTypes.h"
-#include "NPCs.h"
-#include "ObjectModifications.h"
-#include "Outfits.h"
-#include "Quests.h"
-#include "Races.h"
-#include "Weapons.h"
-#include "WorldSpaces.h"
-
-namespace
-{
-	void Patch()
-	{
-		auto patchStart = std::chrono::high_resolution_clock::now();
-
-		ArmorAddons::Patch();
-		Armors::Patch();
-		Cells::Patch();
-		CombatStyles::Patch();
-		Containers::Patch();
-		CObjs::Patch();
-		DefaultObjectManagers::Patch();
-		FormLists::Patch();
-		ImageSpaceAdapters::Patch();
-		Ingestibles::Patch();
-		Keywords::Patch();
-		LeveledLists::Patch();
-		Locations::Patch();
-		MusicTypes::Patch();
-		ObjectModifications::Patch();
-		Outfits::Patch();
-		Quests::Patch();
-		Races::Patch();
-		Weapons::Patch();
-		WorldSpaces::Patch();
-
-		auto patchEnd = std::chrono::high_resolution_clock::now();
-		std::chrono::duration<double> patchDuration = patchEnd - patchStart;
-
-		logger::info("Patch execution time: {} seconds", patchDuration.count());
-	}
-
-	void OnF4SEMessage(F4SE::MessagingInterface::Message* msg)
-	{
-		switch (msg->type)
-		{
-		case F4SE::MessagingInterface::kGameDataReady:
-			Patch();
-			break;
-		}
-	}
-
-	extern "C" DLLEXPORT bool F4SEAPI F4SEPlugin_Query(const F4SE::QueryInterface* a_f4se, F4SE::PluginInfo* a_info)
-	{
-#ifndef NDEBUG
-		auto sink = std::make_shared<spdlog::sinks::msvc_sink_mt>();
-#else
-		auto path = logger::log_directory();
-		if (!path)
-		{
-			return false;
-		}
-
-		*path /= fmt::format("{}.log", Version::PROJECT);
-		auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path->string(), true);
-#endif
-
-		auto log = std::make_shared<spdlog::logger>("Global Log"s, std::move(sink));
-
-#ifndef NDEBUG
-		log->set_level(spdlog::level::trace);
-#else
-		log->set_level(spdlog::level::info);
-		log->flush_on(spdlog::level::trace);
-#endif
-
-		spdlog::set_default_logger(std::move(log));
-		spdlog::set_pattern("[%^%l%$] %v"s);
-
-		logger::info("{} v{}", Version::PROJECT, Version::NAME);
-
-		a_info->infoVersion = F4SE::PluginInfo::kVersion;
-		a_info->name = Version::PROJECT.data();
-		a_info->version = Version::MAJOR;
-
-		if (a_f4se->IsEditor())
-		{
-			logger::critical("loaded in editor");
-			return false;
-		}
-
-		const auto ver = a_f4se->RuntimeVersion();
-		if (ver < F4SE::RUNTIME_1_10_162)
-		{
-			logger::critical("unsupported runtime v{}", ver.string());
-			return false;
-		}
-
-		return true;
-	}
-
-	extern "C" DLLEXPORT bool F4SEAPI F4SEPlugin_Load(const F4SE::LoadInterface* a_f4se)
-	{
-		F4SE::Init(a_f4se);
-
-		auto readConfigStart = std::chrono::high_resolution_clock::now();
-
-		ArmorAddons::ReadConfigs();
-		Armors::ReadConfigs();
-		Cells::ReadConfigs();
-		CombatStyles::ReadConfigs();
-		Containers::ReadConfigs();
-		CObjs::ReadConfigs();
-		DefaultObjectManagers::ReadConfigs();
-		FormLists::ReadConfigs();
-		ImageSpaceAdapters::ReadConfigs();
-		Ingestibles::ReadConfigs();
-		Keywords::ReadConfigs();
-		LeveledLists::ReadConfigs();
-		Locations::ReadConfigs();
-		MusicTypes::ReadConfigs();
-		NPCs::ReadConfigs();
-		ObjectModifications::ReadConfigs();
-		Outfits::ReadConfigs();
-		Quests::ReadConfigs();
-		Races::ReadConfigs();
-		Weapons::ReadConfigs();
-		WorldSpaces::ReadConfigs();
-
-		auto readConfigEnd = std::chrono::high_resolution_clock::now();
-		std::chrono::duration<double> readConfigDuration = readConfigEnd - readConfigStart;
-
-		logger::info("ReadConfig execution time: {} seconds", readConfigDuration.count());
-
-		NPCs::Install();
-
-		const F4SE::MessagingInterface* message = F4SE::GetMessagingInterface();
-		if (message)
-		{
-			message->RegisterListener(OnF4SEMessage);
-		}
-
-		return true;
-	}
-}  // namespace
+#include "ArmorAddons.h"
+#include "Armors.h"
+#include "CObjs.h"
+#include "Cells.h"
+#include "CombatStyles.h"
+#include "Containers.h"
+#include "DefaultObjectManagers.h"
+#include "FormFilters.h"
+#include "FormLists.h"
+#include "ImageSpaceAdapters.h"
+#include "Ingestibles.h"
+#include "Keywords.h"
+#include "LeveledLists.h"
+#include "Locations.h"
+#include "MusicTypes.h"
+#include "NPCs.h"
+#include "ObjectModifications.h"
+#include "Outfits.h"
+#include "PatchScheduler.h"
+#include "Quests.h"
+#include "Races.h"
+#include "Utils.h"
+#include "Weapons.h"
+#include "WorldSpaces.h"
+
+namespace
+{
+	void Patch()
+	{
+		auto patchStart = std::chrono::high_resolution_clock::now();
+
+		Utils::ResolvePendingForms();
+
+		// Each subsystem declares the form types whose data it reads and writes; only conflicting subsystems
+		// keep their relative order. Form types that are only resolved to pointers are not listed as reads.
+		const std::vector<PatchScheduler::Task> tasks{
+			{ "ArmorAddons"sv, ArmorAddons::Patch, {}, { RE::ENUM_FORM_ID::kARMA } },
+			{ "Armors"sv, Armors::Patch, {}, { RE::ENUM_FORM_ID::kARMO } },
+			{ "Cells"sv, Cells::Patch, {}, { RE::ENUM_FORM_ID::kCELL } },
+			{ "CombatStyles"sv, CombatStyles::Patch, {}, { RE::ENUM_FORM_ID::kCSTY } },
+			{ "Containers"sv, Containers::Patch, {}, { RE::ENUM_FORM_ID::kCONT } },
+			{ "CObjs"sv, CObjs::Patch, { RE::ENUM_FORM_ID::kKYWD }, { RE::ENUM_FORM_ID::kCOBJ } },
+			{ "DefaultObjectManagers"sv, DefaultObjectManagers::Patch, {}, { RE::ENUM_FORM_ID::kDOBJ } },
+			{ "FormLists"sv, FormLists::Patch, {}, { RE::ENUM_FORM_ID::kFLST } },
+			{ "ImageSpaceAdapters"sv, ImageSpaceAdapters::Patch, {}, { RE::ENUM_FORM_ID::kIMAD } },
+			{ "Ingestibles"sv, Ingestibles::Patch, {}, { RE::ENUM_FORM_ID::kALCH } },
+			{ "Keywords"sv, Keywords::Patch, {}, { RE::ENUM_FORM_ID::kKYWD } },
+			{ "LeveledLists"sv, LeveledLists::Patch, {}, { RE::ENUM_FORM_ID::kLVLI, RE::ENUM_FORM_ID::kLVLN } },
+			{ "Locations"sv, Locations::Patch, {}, { RE::ENUM_FORM_ID::kLCTN } },
+			{ "MusicTypes"sv, MusicTypes::Patch, {}, { RE::ENUM_FORM_ID::kMUSC } },
+			{ "ObjectModifications"sv, ObjectModifications::Patch, {}, { RE::ENUM_FORM_ID::kOMOD } },
+			{ "Outfits"sv, Outfits::Patch, {}, { RE::ENUM_FORM_ID::kOTFT } },
+			{ "Quests"sv, Quests::Patch, {}, { RE::ENUM_FORM_ID::kQUST } },
+			{ "Races"sv, Races::Patch, {}, { RE::ENUM_FORM_ID::kRACE } },
+			{ "Weapons"sv, Weapons::Patch, {}, { RE::ENUM_FORM_ID::kWEAP } },
+			{ "WorldSpaces"sv, WorldSpaces::Patch, {}, { RE::ENUM_FORM_ID::kWRLD } },
+		};
+
+		PatchScheduler::Run(tasks);
+
+		FormFilters::Clear();
+
+		auto patchEnd = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double> patchDuration = patchEnd - patchStart;
+
+		logger::info("Patch execution time: {} seconds", patchDuration.count());
+
+		Utils::LogFormCacheStatistics();
+	}
+
+	void OnF4SEMessage(F4SE::MessagingInterface::Message* msg)
+	{
+		switch (msg->type)
+		{
+		case F4SE::MessagingInterface::kGameDataReady:
+			Utils::BuildPluginIndex();
+			Patch();
+			// NPC patches are applied by a hook later on; their index is prepared here, after Patch() because it
+			// shares the form caches and form filters.
+			NPCs::PreparePatch();
+			break;
+		}
+	}
+
+	extern "C" DLLEXPORT bool F4SEAPI F4SEPlugin_Query(const F4SE::QueryInterface* a_f4se, F4SE::PluginInfo* a_info)
+	{
+#ifndef NDEBUG
+		auto sink = std::make_shared<spdlog::sinks::msvc_sink_mt>();
+#else
+		auto path = logger::log_directory();
+		if (!path)
+		{
+			return false;
+		}
+
+		*path /= fmt::format("{}.log", Version::PROJECT);
+		auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path->string(), true);
+#endif
+
+		auto log = std::make_shared<spdlog::logger>("Global Log"s, PatchScheduler::WrapSink(std::move(sink)));
+
+#ifndef NDEBUG
+		log->set_level(spdlog::level::trace);
+#else
+		log->set_level(spdlog::level::info);
+		log->flush_on(spdlog::level::trace);
+#endif
+
+		spdlog::set_default_logger(std::move(log));
+		spdlog::set_pattern("[%^%l%$] %v"s);
+
+		logger::info("{} v{}", Version::PROJECT, Version::NAME);
+
+		a_info->infoVersion = F4SE::PluginInfo::kVersion;
+		a_info->name = Version::PROJECT.data();
+		a_info->version = Version::MAJOR;
+
+		if (a_f4se->IsEditor())
+		{
+			logger::critical("loaded in editor");
+			return false;
+		}
+
+		const auto ver = a_f4se->RuntimeVersion();
+		if (ver < F4SE::RUNTIME_1_10_162)
+		{
+			logger::critical("unsupported runtime v{}", ver.string());
+			return false;
+		}
+
+		return true;
+	}
+
+	extern "C" DLLEXPORT bool F4SEAPI F4SEPlugin_Load(const F4SE::LoadInterface* a_f4se)
+	{
+		F4SE::Init(a_f4se);
+
+		auto readConfigStart = std::chrono::high_resolution_clock::now();
+
+		ArmorAddons::ReadConfigs();
+		Armors::ReadConfigs();
+		Cells::ReadConfigs();
+		CombatStyles::ReadConfigs();
+		Containers::ReadConfigs();
+		CObjs::ReadConfigs();
+		DefaultObjectManagers::ReadConfigs();
+		FormLists::ReadConfigs();
+		ImageSpaceAdapters::ReadConfigs();
+		Ingestibles::ReadConfigs();
+		Keywords::ReadConfigs();
+		LeveledLists::ReadConfigs();
+		Locations::ReadConfigs();
+		MusicTypes::ReadConfigs();
+		NPCs::ReadConfigs();
+		ObjectModifications::ReadConfigs();
+		Outfits::ReadConfigs();
+		Quests::ReadConfigs();
+		Races::ReadConfigs();
+		Weapons::ReadConfigs();
+		WorldSpaces::ReadConfigs();
+
+		auto readConfigEnd = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double> readConfigDuration = readConfigEnd - readConfigStart;
+
+		logger::info("ReadConfig execution time: {} seconds", readConfigDuration.count());
+
+		NPCs::Install();
+
+		const F4SE::MessagingInterface* message = F4SE::GetMessagingInterface();
+		if (message)
+		{
+			message->RegisterListener(OnF4SEMessage);
+		}
+
+		return true;
+	}
+}  // namespace